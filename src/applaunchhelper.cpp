@@ -31,21 +31,29 @@
     #include <winextras.h>
 #endif
 
-AppLaunchHelper::AppLaunchHelper(AntiMicroSettings *settings, bool graphical, QObject *parent)
+AppLaunchHelper::AppLaunchHelper(AntiMicroSettings *settings, bool graphical, bool headless, QObject *parent)
     : QObject(parent)
 {
     this->settings = settings;
     this->graphical = graphical;
+    this->headless = headless;
 }
 
+/**
+ * @brief Applies the mouse and polling settings. In headless mode,
+ *     everything except the screen dependent spring mode setting is applied.
+ */
 void AppLaunchHelper::initRunMethods()
 {
-    if (graphical)
+    if (graphical || headless)
     {
         establishMouseTimerConnections();
         enablePossibleMouseSmoothing();
         changeMouseRefreshRate();
-        changeSpringModeScreen();
+
+        if (graphical)
+            changeSpringModeScreen();
+
         changeGamepadPollRate();
 #ifdef Q_OS_WIN
         checkPointerPrecision();
@@ -65,8 +73,7 @@ void AppLaunchHelper::enablePossibleMouseSmoothing()
         {
             JoyButton::setMouseHistorySize(historySize, GlobalVariables::JoyButton::MAXIMUMMOUSEHISTORYSIZE,
                                            GlobalVariables::JoyButton::mouseHistorySize,
-                                           &GlobalVariables::JoyButton::mouseHistoryX,
-                                           &GlobalVariables::JoyButton::mouseHistoryY);
+                                           &GlobalVariables::JoyButton::mouseHistory);
         }
 
         double weightModifier = settings->value("Mouse/WeightModifier", 0.0).toDouble();
@@ -74,22 +81,26 @@ void AppLaunchHelper::enablePossibleMouseSmoothing()
         if (weightModifier > 0.0)
         {
             JoyButton::setWeightModifier(weightModifier, GlobalVariables::JoyButton::MAXIMUMWEIGHTMODIFIER,
-                                         GlobalVariables::JoyButton::weightModifier);
+                                         GlobalVariables::JoyButton::weightModifier,
+                                         &GlobalVariables::JoyButton::mouseHistory);
         }
     }
 }
 
 void AppLaunchHelper::changeMouseRefreshRate()
 {
-    int refreshRate = settings->value("Mouse/RefreshRate", 0).toInt();
+    int refreshPeriod = settings->value("Mouse/RefreshPeriodUsec", 0).toInt();
+
+    // Fall back to the whole ms setting written by older versions.
+    if (refreshPeriod <= 0)
+        refreshPeriod = settings->value("Mouse/RefreshRate", 0).toInt() * 1000;
 
-    if (refreshRate > 0)
+    if (refreshPeriod > 0)
     {
-        JoyButton::setMouseRefreshRate(refreshRate, GlobalVariables::JoyButton::mouseRefreshRate,
-                                       GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE, JoyButton::getMouseHelper(),
-                                       &GlobalVariables::JoyButton::mouseHistoryX,
-                                       &GlobalVariables::JoyButton::mouseHistoryY, JoyButton::getTestOldMouseTime(),
-                                       JoyButton::getStaticMouseEventTimer());
+        JoyButton::setMouseRefreshPeriod(refreshPeriod, GlobalVariables::JoyButton::mouseRefreshRate,
+                                         GlobalVariables::JoyButton::mouseRefreshPeriodUsec, JoyButton::getMouseHelper(),
+                                         &GlobalVariables::JoyButton::mouseHistory, JoyButton::getTestOldMouseTime(),
+                                         JoyButton::getStaticMouseEventTimer());
     }
 }
 
@@ -172,7 +183,7 @@ void AppLaunchHelper::revertMouseThread()
 void AppLaunchHelper::changeMouseThread(QThread *thread)
 {
     JoyButton::setStaticMouseThread(thread, JoyButton::getStaticMouseEventTimer(), JoyButton::getTestOldMouseTime(),
-                                    GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE, JoyButton::getMouseHelper());
+                                    JoyButton::getMouseHelper());
 }
 
 void AppLaunchHelper::establishMouseTimerConnections() { JoyButton::establishMouseTimerConnections(); }
@@ -32,7 +32,8 @@ class AppLaunchHelper : public QObject
     Q_OBJECT
 
   public:
-    explicit AppLaunchHelper(AntiMicroSettings *settings, bool graphical = false, QObject *parent = 0);
+    explicit AppLaunchHelper(AntiMicroSettings *settings, bool graphical = false, bool headless = false,
+                             QObject *parent = 0);
 
     void printControllerList(QMap<SDL_JoystickID, InputDevice *> *joysticks);
 
@@ -59,6 +60,7 @@ class AppLaunchHelper : public QObject
   private:
     AntiMicroSettings *settings;
     bool graphical;
+    bool headless;
 };
 
 #endif // APPLAUNCHHELPER_H
@@ -0,0 +1,140 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "autoprofiletitlematcher.h"
+
+#include <QQueue>
+
+AutoProfileTitleMatcher::AutoProfileTitleMatcher() { clear(); }
+
+void AutoProfileTitleMatcher::clear()
+{
+    m_nodes.clear();
+    m_nodes.append({0, {}, {}});
+    m_edges.clear();
+    m_patterns.clear();
+}
+
+/**
+ * @brief Adds a pattern to the trie. build() has to be called before
+ *  searching again.
+ * @returns Id of the pattern which is reported by findMatches().
+ */
+int AutoProfileTitleMatcher::addPattern(const QString &pattern)
+{
+    int id = m_patterns.size();
+    m_patterns.append(pattern);
+
+    int state = 0;
+    for (QChar ch : pattern)
+    {
+        quint64 key = edgeKey(state, ch.unicode());
+        auto iter = m_edges.constFind(key);
+
+        if (iter != m_edges.constEnd())
+        {
+            state = iter.value();
+        } else
+        {
+            int next = m_nodes.size();
+            m_nodes.append({0, {}, {}});
+            m_nodes[state].children.append(qMakePair(ch.unicode(), next));
+            m_edges.insert(key, next);
+            state = next;
+        }
+    }
+
+    m_nodes[state].outputs.append(id);
+    return id;
+}
+
+/**
+ * @brief Calculates the fail links of all states in breadth first order.
+ */
+void AutoProfileTitleMatcher::build()
+{
+    QQueue<int> pending;
+
+    for (const auto &child : m_nodes.at(0).children)
+    {
+        m_nodes[child.second].fail = 0;
+        pending.enqueue(child.second);
+    }
+
+    while (!pending.isEmpty())
+    {
+        int state = pending.dequeue();
+
+        for (const auto &child : m_nodes.at(state).children)
+        {
+            int fail = m_nodes.at(state).fail;
+            auto iter = m_edges.constFind(edgeKey(fail, child.first));
+
+            while ((fail != 0) && (iter == m_edges.constEnd()))
+            {
+                fail = m_nodes.at(fail).fail;
+                iter = m_edges.constFind(edgeKey(fail, child.first));
+            }
+
+            fail = (iter != m_edges.constEnd()) ? iter.value() : 0;
+
+            Node &node = m_nodes[child.second];
+            node.fail = fail;
+            node.outputs.append(m_nodes.at(fail).outputs);
+            pending.enqueue(child.second);
+        }
+    }
+}
+
+/**
+ * @brief Searches the text for all patterns in a single pass.
+ * @returns Ids of all contained patterns, each reported once.
+ */
+QVector<int> AutoProfileTitleMatcher::findMatches(const QString &text) const
+{
+    QVector<int> result;
+
+    if (m_patterns.isEmpty())
+        return result;
+
+    QVector<bool> found(m_patterns.size(), false);
+    int state = 0;
+
+    for (QChar ch : text)
+    {
+        auto iter = m_edges.constFind(edgeKey(state, ch.unicode()));
+
+        while ((state != 0) && (iter == m_edges.constEnd()))
+        {
+            state = m_nodes.at(state).fail;
+            iter = m_edges.constFind(edgeKey(state, ch.unicode()));
+        }
+
+        state = (iter != m_edges.constEnd()) ? iter.value() : 0;
+
+        for (int id : m_nodes.at(state).outputs)
+        {
+            if (!found.at(id))
+            {
+                found[id] = true;
+                result.append(id);
+            }
+        }
+    }
+
+    return result;
+}
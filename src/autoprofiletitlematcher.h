@@ -0,0 +1,65 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief Finds all of a set of patterns which are contained in a text.
+ *
+ * The patterns are compiled into an Aho-Corasick automaton, so a text is
+ * scanned only once no matter how many patterns there are. Used to match
+ * window titles against auto profile rules which match a part of the title.
+ */
+class AutoProfileTitleMatcher
+{
+  public:
+    AutoProfileTitleMatcher();
+
+    void clear();
+    int addPattern(const QString &pattern);
+    void build();
+
+    QVector<int> findMatches(const QString &text) const;
+
+    /**
+     * @brief Gets the pattern with the given id.
+     */
+    inline const QString &getPattern(int id) const { return m_patterns.at(id); }
+    /**
+     * @brief Gets the amount of added patterns.
+     */
+    inline int getPatternCount() const { return m_patterns.size(); }
+
+  private:
+    struct Node
+    {
+        // State to continue with if no edge matches the next character.
+        int fail;
+        // Ids of all patterns ending in this state, including those of fail states.
+        QVector<int> outputs;
+        QVector<QPair<ushort, int>> children;
+    };
+
+    static inline quint64 edgeKey(int state, ushort ch) { return (static_cast<quint64>(state) << 16) | ch; }
+
+    QVector<Node> m_nodes;
+    QHash<quint64, int> m_edges;
+    QStringList m_patterns;
+};
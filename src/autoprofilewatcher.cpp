@@ -20,6 +20,8 @@
 
 #include "antimicrosettings.h"
 #include "autoprofileinfo.h"
+#include "logger.h"
+#include "profilepool.h"
 
 #include <QApplication>
 #include <QDebug>
@@ -28,6 +30,7 @@
 #include <QFileInfo>
 #include <QListIterator>
 #include <QSetIterator>
+#include <QSocketNotifier>
 #include <QStringListIterator>
 
 #if defined(Q_OS_UNIX) && defined(WITH_X11)
@@ -43,6 +46,10 @@ QTimer AutoProfileWatcher::checkWindowTimer;
 
 AutoProfileWatcher::AutoProfileWatcher(AntiMicroSettings *settings, QObject *parent)
     : QObject(parent)
+    , windowEventNotifier(nullptr)
+    , watchedWindow(0)
+    , windowChangePending(false)
+    , lastSwitchLatency(-1.0)
 {
     this->settings = settings;
     allDefaultInfo = nullptr;
@@ -56,6 +63,8 @@ AutoProfileWatcher::AutoProfileWatcher(AntiMicroSettings *settings, QObject *par
 
 AutoProfileWatcher::~AutoProfileWatcher()
 {
+    stopWindowEventWatching();
+
     if (checkWindowTimer.isActive())
     {
         checkWindowTimer.stop();
@@ -71,11 +80,138 @@ void AutoProfileWatcher::disconnectWindowTimer()
 {
     checkWindowTimer.stop();
     disconnect(&(checkWindowTimer), &QTimer::timeout, _instance, nullptr);
+
+    if (_instance != nullptr)
+        _instance->stopWindowEventWatching();
 }
 
-void AutoProfileWatcher::startTimer() { checkWindowTimer.start(CHECKTIME); }
+/**
+ * @brief Starts watching the active window. Window change events are used
+ *  when available, otherwise the active window is polled.
+ */
+void AutoProfileWatcher::startTimer()
+{
+    if (!startWindowEventWatching())
+        checkWindowTimer.start(CHECKTIME);
+}
 
-void AutoProfileWatcher::stopTimer() { checkWindowTimer.stop(); }
+void AutoProfileWatcher::stopTimer()
+{
+    checkWindowTimer.stop();
+    stopWindowEventWatching();
+}
+
+/**
+ * @brief Checks whether window changes are received as events instead of polling.
+ */
+bool AutoProfileWatcher::isEventDriven() const
+{
+    return (windowEventNotifier != nullptr) && windowEventNotifier->isEnabled();
+}
+
+/**
+ * @brief Subscribes to _NET_ACTIVE_WINDOW changes on the root window.
+ *  Subscribing to windows of other clients needs XCB support.
+ * @returns False if the platform or window manager does not support it.
+ */
+bool AutoProfileWatcher::startWindowEventWatching()
+{
+#if defined(Q_OS_UNIX) && defined(WITH_X11) && defined(WITH_XCB)
+    X11Extras *extras = X11Extras::getInstance();
+
+    if (!extras->hasValidDisplay() || !extras->isActiveWindowHintSupported())
+    {
+        DEBUG() << "Window manager does not support _NET_ACTIVE_WINDOW, polling the focused window instead";
+        return false;
+    }
+
+    if (windowEventNotifier == nullptr)
+    {
+        windowEventNotifier = new QSocketNotifier(extras->getConnectionNumber(), QSocketNotifier::Read, this);
+        connect(windowEventNotifier, &QSocketNotifier::activated, this, &AutoProfileWatcher::processWindowEvents);
+    }
+
+    extras->selectPropertyEvents(extras->appRootWindow(), true);
+    windowEventNotifier->setEnabled(true);
+    watchActiveWindow();
+    runAppCheck();
+    // Events may have been queued by the round trips of the initial check.
+    processWindowEvents();
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AutoProfileWatcher::stopWindowEventWatching()
+{
+#if defined(Q_OS_UNIX) && defined(WITH_X11)
+    if (!isEventDriven())
+        return;
+
+    windowEventNotifier->setEnabled(false);
+
+    X11Extras *extras = X11Extras::getInstance();
+    extras->selectPropertyEvents(extras->appRootWindow(), false);
+    extras->selectPropertyEvents(watchedWindow, false);
+    watchedWindow = 0;
+    windowChangePending = false;
+
+    // Discard events which arrived before unsubscribing.
+    extras->readWindowChanges(0);
+#endif
+}
+
+/**
+ * @brief Moves the title change subscription to the current active window.
+ */
+void AutoProfileWatcher::watchActiveWindow()
+{
+#if defined(Q_OS_UNIX) && defined(WITH_X11)
+    X11Extras *extras = X11Extras::getInstance();
+    unsigned long activeWindow = extras->getActiveWindow();
+
+    if (activeWindow != watchedWindow)
+    {
+        extras->selectPropertyEvents(watchedWindow, false);
+        extras->selectPropertyEvents(activeWindow, true);
+        watchedWindow = activeWindow;
+    }
+#endif
+}
+
+/**
+ * @brief Handles PropertyNotify events of the root and the active window.
+ *  Other X requests on this thread can move events into the Xlib queue
+ *  without the socket becoming readable, so the queue is drained until
+ *  no more changes are found.
+ */
+void AutoProfileWatcher::processWindowEvents()
+{
+#if defined(Q_OS_UNIX) && defined(WITH_X11)
+    X11Extras *extras = X11Extras::getInstance();
+    int changes = extras->readWindowChanges(watchedWindow);
+
+    while (changes != X11Extras::NoWindowChange)
+    {
+        if (!windowChangePending)
+        {
+            windowChangePending = true;
+            windowChangeTime.start();
+        }
+
+        if (changes & X11Extras::ActiveWindowChanged)
+            watchActiveWindow();
+
+        runAppCheck();
+        changes = extras->readWindowChanges(watchedWindow);
+    }
+
+    // Changes which did not result in a different window are not measured.
+    windowChangePending = false;
+#endif
+}
 
 void AutoProfileWatcher::runAppCheck()
 {
@@ -85,14 +221,8 @@ void AutoProfileWatcher::runAppCheck()
     QString baseAppFileName = QString();
     getUniqeIDSetLocal().clear();
 
-    // Check whether program path needs to be parsed. Removes processing time
-    // and need to run Linux specific code searching /proc.
-#ifdef Q_OS_LINUX
-    if (!appProfileAssignments.isEmpty())
-    {
-        appLocation = findAppLocation();
-    }
-#else
+    // On Linux, the program path is resolved together with the window below.
+#ifndef Q_OS_LINUX
     // In Windows, get program location no matter what.
     appLocation = findAppLocation();
     if (!appLocation.isEmpty())
@@ -101,8 +231,6 @@ void AutoProfileWatcher::runAppCheck()
     }
 #endif
 
-    qDebug() << "appLocation is " << appLocation;
-
     // More portable check for whether antimicrox is the current application
     // with focus.
     QWidget *focusedWidget = qApp->activeWindow();
@@ -114,26 +242,31 @@ void AutoProfileWatcher::runAppCheck()
 #ifdef Q_OS_WIN
     nowWindowName = WinExtras::getCurrentWindowText();
 #else
-    long currentWindow = X11Extras::getInstance()->getWindowInFocus();
-    qDebug() << "getWindowInFocus: " << currentWindow;
+    // The active window is already known when window changes are received as events.
+    bool eventDriven = isEventDriven();
+    unsigned long currentWindow = eventDriven ? watchedWindow : X11Extras::getInstance()->getWindowInFocus();
+    qDebug() << "window in focus: " << currentWindow;
 
     if (currentWindow > 0)
     {
-        long tempWindow = X11Extras::getInstance()->findParentClient(currentWindow);
-        qDebug() << "findParentClient: " << tempWindow;
-
-        if (tempWindow > 0)
-            currentWindow = tempWindow;
+        // Without title change events, the title has to be queried every time.
+        const X11Extras::WindowInfo &windowInfo =
+            X11Extras::getInstance()->getWindowInfo(static_cast<Window>(currentWindow), !eventDriven);
 
-        nowWindow = QString::number(currentWindow);
+        nowWindow = QString::number(windowInfo.clientWindow);
         qDebug() << "number of window now: " << nowWindow;
 
-        nowWindowClass = X11Extras::getInstance()->getWindowClass(static_cast<Window>(currentWindow));
+        nowWindowClass = windowInfo.windowClass;
         qDebug() << "class of window now: " << nowWindowClass;
 
-        nowWindowName = X11Extras::getInstance()->getWindowTitle(static_cast<Window>(currentWindow));
+        nowWindowName = windowInfo.title;
         qDebug() << "title of window now: " << nowWindowName;
+
+        // Check whether program path is needed at all.
+        if (!appProfileAssignments.isEmpty())
+            appLocation = windowInfo.exePath;
     }
+    qDebug() << "appLocation is " << appLocation;
     qDebug() << "WINDOW CLASS: " << nowWindowClass;
     qDebug() << "WINDOW IN FOCUS: " << nowWindow;
 #endif
@@ -203,72 +336,37 @@ void AutoProfileWatcher::runAppCheck()
             fullSet.unite(tempSet);
         }
 
-        // part window title
+        // whole or part window title
         if (!nowWindowName.isEmpty())
         {
-            QHashIterator<QString, QList<AutoProfileInfo *>> iter(getWindowNameProfileAssignments());
-            while (iter.hasNext())
+            if (getWindowNameProfileAssignments().contains(nowWindowName))
             {
-                iter.next();
-
-                bool hasOnePartName = false;
-
-                QListIterator<AutoProfileInfo *> iterList(iter.value());
-                while (iterList.hasNext())
-                {
-                    AutoProfileInfo *autoInfo = iterList.next();
-
-                    if (autoInfo->isPartialState())
-                    {
-                        hasOnePartName = true;
-                        break;
-                    }
-                }
-
-                if (hasOnePartName)
-                {
-                    qDebug() << "IT HAS A PARTIAL TITLE NAME";
-
-                    if (nowWindowName.contains(iter.key()))
-                    {
-                        qDebug() << "WINDOW: \"" << nowWindowName << "\" includes \"" << iter.key() << "\"";
+                qDebug() << "WINDOW: \"" << nowWindowName << "\" is equal to a hash key";
 
-                        QSet<AutoProfileInfo *> tempSet;
-                        QList<AutoProfileInfo *> list = iter.value();
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-                        tempSet = QSet<AutoProfileInfo *>(list.begin(), list.end());
+                auto templist = getWindowNameProfileAssignments().value(nowWindowName);
+                QSet<AutoProfileInfo *> tempSet(templist.begin(), templist.end());
 #else
-                        tempSet = list.toSet();
+                QSet<AutoProfileInfo *> tempSet;
+                tempSet = getWindowNameProfileAssignments().value(nowWindowName).toSet();
 #endif
-                        fullSet = fullSet.unite(tempSet);
-
-                    } else
-                    {
-                        qDebug() << "WINDOW: \"" << nowWindowName << "\" doesn't include \"" << iter.key() << "\"";
-                    }
-
-                } else
-                {
-                    qDebug() << "IT HAS A FULL TITLE NAME";
+                fullSet.unite(tempSet);
+            }
 
-                    if (iter.key() == nowWindowName)
-                    {
-                        qDebug() << "WINDOW: \"" << nowWindowName << "\" is equal to hash key: \"" << iter.key() << "\"";
+            // Single pass over the title for all partial title rules
+            for (int patternId : partialTitleMatcher.findMatches(nowWindowName))
+            {
+                const QString &partialTitle = partialTitleMatcher.getPattern(patternId);
+                qDebug() << "WINDOW: \"" << nowWindowName << "\" includes \"" << partialTitle << "\"";
 
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-                        auto templist = getWindowNameProfileAssignments().value(nowWindowName);
-                        QSet<AutoProfileInfo *> tempSet(templist.begin(), templist.end());
+                auto templist = getWindowNameProfileAssignments().value(partialTitle);
+                QSet<AutoProfileInfo *> tempSet(templist.begin(), templist.end());
 #else
-                        QSet<AutoProfileInfo *> tempSet;
-                        tempSet = getWindowNameProfileAssignments().value(nowWindowName).toSet();
+                QSet<AutoProfileInfo *> tempSet;
+                tempSet = getWindowNameProfileAssignments().value(partialTitle).toSet();
 #endif
-                        fullSet = fullSet.unite(tempSet);
-
-                    } else
-                    {
-                        qDebug() << "WINDOW: \"" << nowWindowName << "\" is not equal to hash key: \"" << iter.key() << "\"";
-                    }
-                }
+                fullSet.unite(tempSet);
             }
         }
 
@@ -346,6 +444,16 @@ void AutoProfileWatcher::runAppCheck()
                 }
             }
         }
+
+        if (windowChangePending)
+        {
+            windowChangePending = false;
+            lastSwitchLatency = windowChangeTime.nsecsElapsed() / 1000000.0;
+            switchLatency.process(lastSwitchLatency);
+
+            DEBUG() << "Active window change handled after " << lastSwitchLatency << " ms, mean "
+                    << switchLatency.getMean() << " ms";
+        }
     }
 }
 
@@ -524,6 +632,71 @@ void AutoProfileWatcher::syncProfileAssignment()
 
     settings->endGroup();
     settings->getLock()->unlock();
+
+    rebuildTitleMatcher();
+    preloadProfiles();
+}
+
+/**
+ * @brief Reads the profiles of all active rules in the background, so
+ *  switching to them does not wait for storage.
+ */
+void AutoProfileWatcher::preloadProfiles()
+{
+    QStringList locations;
+
+    if (allDefaultInfo != nullptr)
+        locations.append(allDefaultInfo->getProfileLocation());
+
+    for (AutoProfileInfo *info : defaultProfileAssignments)
+        locations.append(info->getProfileLocation());
+
+    for (const QList<AutoProfileInfo *> &infos : appProfileAssignments)
+    {
+        for (AutoProfileInfo *info : infos)
+            locations.append(info->getProfileLocation());
+    }
+
+    for (const QList<AutoProfileInfo *> &infos : windowClassProfileAssignments)
+    {
+        for (AutoProfileInfo *info : infos)
+            locations.append(info->getProfileLocation());
+    }
+
+    for (const QList<AutoProfileInfo *> &infos : windowNameProfileAssignments)
+    {
+        for (AutoProfileInfo *info : infos)
+            locations.append(info->getProfileLocation());
+    }
+
+    locations.removeDuplicates();
+    ProfilePool::getInstance()->preload(locations);
+}
+
+/**
+ * @brief Compiles all window titles of rules which match a part of the
+ *  title into a single matcher.
+ */
+void AutoProfileWatcher::rebuildTitleMatcher()
+{
+    partialTitleMatcher.clear();
+
+    QHashIterator<QString, QList<AutoProfileInfo *>> iter(getWindowNameProfileAssignments());
+    while (iter.hasNext())
+    {
+        iter.next();
+
+        for (AutoProfileInfo *info : iter.value())
+        {
+            if (info->isPartialState())
+            {
+                partialTitleMatcher.addPattern(iter.key());
+                break;
+            }
+        }
+    }
+
+    partialTitleMatcher.build();
 }
 
 void AutoProfileWatcher::clearProfileAssignments()
@@ -570,6 +743,7 @@ void AutoProfileWatcher::clearProfileAssignments()
     }
 
     windowNameProfileAssignments.clear();
+    partialTitleMatcher.clear();
 
     QSetIterator<AutoProfileInfo *> iterTerminate(terminateProfiles);
 
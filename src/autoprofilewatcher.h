@@ -19,6 +19,10 @@
 #ifndef AUTOPROFILEWATCHER_H
 #define AUTOPROFILEWATCHER_H
 
+#include "autoprofiletitlematcher.h"
+#include "statisticsestimator.h"
+
+#include <QElapsedTimer>
 #include <QHash>
 #include <QSet>
 #include <QTimer>
@@ -26,11 +30,14 @@
 class AntiMicroSettings;
 class AutoProfileInfo;
 class QSettings;
+class QSocketNotifier;
 
 /**
  * @brief Manages auto profile functionality. Allows for profiles to be associated with specific applications.
  *
  * Watches currently focused window and changes current set to pre-defined one when app is recognized.
+ * On X11 with an EWMH compliant window manager, changes of the active window and its title are received
+ * as PropertyNotify events. Otherwise the focused window is polled every CHECKTIME ms.
  */
 class AutoProfileWatcher : public QObject
 {
@@ -53,6 +60,18 @@ class AutoProfileWatcher : public QObject
     QHash<QString, QList<AutoProfileInfo *>> const &getWindowNameProfileAssignments();
     QHash<QString, AutoProfileInfo *> const &getDefaultProfileAssignments();
 
+    bool isEventDriven() const;
+    /**
+     * @brief Gets the time between the last window change event and the resulting profile check.
+     * @returns Latency in ms or a negative value if none was measured yet.
+     */
+    inline double getLastSwitchLatency() const { return lastSwitchLatency; }
+    /**
+     * @brief Gets the mean latency of all event triggered profile checks.
+     * @returns Mean latency in ms.
+     */
+    inline double getMeanSwitchLatency() const { return switchLatency.getMean(); }
+
     static const int CHECKTIME = 500; // time in ms
 
   protected:
@@ -68,10 +87,16 @@ class AutoProfileWatcher : public QObject
 
   private slots:
     void runAppCheck();
+    void processWindowEvents();
 
   private:
     // QSet<QString>& getGuidSetLocal();
     QSet<QString> &getUniqeIDSetLocal();
+    bool startWindowEventWatching();
+    void stopWindowEventWatching();
+    void watchActiveWindow();
+    void rebuildTitleMatcher();
+    void preloadProfiles();
 
     static AutoProfileWatcher *_instance;
     static QTimer checkWindowTimer;
@@ -80,11 +105,19 @@ class AutoProfileWatcher : public QObject
     QHash<QString, QList<AutoProfileInfo *>> windowClassProfileAssignments;
     QHash<QString, QList<AutoProfileInfo *>> windowNameProfileAssignments;
     QHash<QString, AutoProfileInfo *> defaultProfileAssignments;
+    AutoProfileTitleMatcher partialTitleMatcher;
     AutoProfileInfo *allDefaultInfo;
     QString currentApplication;
     QString currentAppWindowTitle;
     // QSet<QString> guidSet;
     QSet<QString> uniqueIDSet;
+
+    QSocketNotifier *windowEventNotifier;
+    unsigned long watchedWindow;
+    bool windowChangePending;
+    QElapsedTimer windowChangeTime;
+    double lastSwitchLatency;
+    StatisticsEstimator switchLatency;
 };
 
 #endif // AUTOPROFILEWATCHER_H
@@ -38,9 +38,11 @@ CommandLineUtility::CommandLineUtility(QObject *parent)
     controllerNumber = 0;
     hiddenRequest = false;
     showRequest = false;
+    headlessRequest = false;
     unloadProfile = false;
     startSetNumber = 0;
     listControllers = false;
+    benchmarkMouseCurves = false;
     currentLogLevel = Logger::LOG_NONE;
 
     currentListsIndex = 0;
@@ -50,7 +52,7 @@ CommandLineUtility::CommandLineUtility(QObject *parent)
     eventGenerator = EventHandlerFactory::fallBackIdentifier();
 }
 
-void CommandLineUtility::parseArguments(const QApplication &parsed_app)
+void CommandLineUtility::parseArguments(const QCoreApplication &parsed_app)
 {
     QCommandLineParser parser;
     parser.setApplicationDescription(
@@ -69,6 +71,8 @@ void CommandLineUtility::parseArguments(const QApplication &parsed_app)
         {"hidden", QCoreApplication::translate("main", "Launch program without the main window displayed")},
         {"show", QCoreApplication::translate(
                      "main", "Show app window when hidden. (Used for unhiding window of already running app instance).")},
+        {"headless", QCoreApplication::translate("main", "Run without any graphical interface. Profiles are only "
+                                                         "controlled by settings and the command line.")},
         {"profile",
          QCoreApplication::translate("main",
                                      "Launch program with the configuration file selected as the default for selected "
@@ -100,6 +104,13 @@ void CommandLineUtility::parseArguments(const QApplication &parsed_app)
                                              "only if you have sdl "
                                              "library. You can check your controller index, name or "
                                              "even GUID.")},
+        {"benchmark-profile",
+         QCoreApplication::translate("main", "Compare the time it takes to parse a profile with the time it takes to "
+                                             "load it from the profile cache and exit."),
+         QCoreApplication::translate("main", "location")},
+        {"benchmark-mouse-curves",
+         QCoreApplication::translate("main", "Compare the time it takes to calculate each mouse curve with the time "
+                                             "it takes to look it up in its precalculated table and exit.")},
         // {"next",
         //     QCoreApplication::translate("main", "Advance profile loading set
         //     options")},
@@ -146,6 +157,11 @@ void CommandLineUtility::parseArguments(const QApplication &parsed_app)
             showRequest = true;
         }
 
+        if (parser.isSet("headless"))
+        {
+            headlessRequest = true;
+        }
+
         if (parser.isSet("unload"))
         {
             parseArgsUnload(parser);
@@ -168,6 +184,23 @@ void CommandLineUtility::parseArguments(const QApplication &parsed_app)
             listControllers = true;
         }
 
+        if (parser.isSet("benchmark-profile"))
+        {
+            if (!QFileInfo(parser.value("benchmark-profile")).isFile())
+            {
+                throw std::runtime_error(QObject::tr("Profile location %1 does not exist.")
+                                             .arg(parser.value("benchmark-profile"))
+                                             .toStdString());
+            }
+
+            benchmarkProfileLocation = parser.value("benchmark-profile");
+        }
+
+        if (parser.isSet("benchmark-mouse-curves"))
+        {
+            benchmarkMouseCurves = true;
+        }
+
 #if (defined(WITH_UINPUT) && defined(WITH_XTEST))
 
         if (parser.isSet("eventgen"))
@@ -223,6 +256,8 @@ void CommandLineUtility::parseArguments(const QApplication &parsed_app)
     }
     if (showRequest && hiddenRequest)
         throw std::runtime_error(QObject::tr("Specified contradicting flags: --show and --hidden").toStdString());
+    if (showRequest && headlessRequest)
+        throw std::runtime_error(QObject::tr("Specified contradicting flags: --show and --headless").toStdString());
 }
 
 void CommandLineUtility::parseArgsProfile(const QCommandLineParser &parser)
@@ -386,6 +421,23 @@ bool CommandLineUtility::isHiddenRequested() { return hiddenRequest; }
 
 bool CommandLineUtility::isShowRequested() { return showRequest; }
 
+bool CommandLineUtility::isHeadlessRequested() { return headlessRequest; }
+
+/**
+ * @brief Checks for the headless flag before any application object exists,
+ *  which is needed to decide which kind of application to create.
+ */
+bool CommandLineUtility::hasHeadlessArgument(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (qstrcmp(argv[i], "--headless") == 0)
+            return true;
+    }
+
+    return false;
+}
+
 bool CommandLineUtility::hasControllerID() { return !controllerIDString.isEmpty(); }
 
 QString CommandLineUtility::getControllerID() { return controllerIDString; }
@@ -398,6 +450,12 @@ int CommandLineUtility::getJoyStartSetNumber() { return startSetNumber - 1; }
 
 bool CommandLineUtility::shouldListControllers() { return listControllers; }
 
+bool CommandLineUtility::shouldBenchmarkProfile() { return !benchmarkProfileLocation.isEmpty(); }
+
+bool CommandLineUtility::shouldBenchmarkMouseCurves() { return benchmarkMouseCurves; }
+
+QString CommandLineUtility::getBenchmarkProfileLocation() { return benchmarkProfileLocation; }
+
 QString CommandLineUtility::getEventGenerator() { return eventGenerator; }
 
 Logger::LogLevel CommandLineUtility::getCurrentLogLevel() { return currentLogLevel; }
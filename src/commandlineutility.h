@@ -91,7 +91,9 @@ class CommandLineUtility : public QObject
      * @param parsed_app
      * @exception std::runtime_error - in case of problems with parsing like unknown flag, wrong value etc
      */
-    void parseArguments(const QApplication &parsed_app);
+    void parseArguments(const QCoreApplication &parsed_app);
+
+    static bool hasHeadlessArgument(int argc, char *argv[]);
 
     bool isLaunchInTrayEnabled();
     bool isTrayHidden();
@@ -100,8 +102,11 @@ class CommandLineUtility : public QObject
     bool hasControllerID();
     bool isHiddenRequested();
     bool isShowRequested();
+    bool isHeadlessRequested();
     bool isUnloadRequested();
     bool shouldListControllers();
+    bool shouldBenchmarkProfile();
+    bool shouldBenchmarkMouseCurves();
     bool hasProfileInOptions();
 
     int getControllerNumber();
@@ -112,6 +117,7 @@ class CommandLineUtility : public QObject
     QString getProfileLocation();
     QString getEventGenerator();
     QString getCurrentLogFile();
+    QString getBenchmarkProfileLocation();
 
     QList<int> *getJoyStartSetNumberList();
     QList<ControllerOptionsInfo> const &getControllerOptionsList();
@@ -124,8 +130,10 @@ class CommandLineUtility : public QObject
     bool hideTrayIcon;
     bool hiddenRequest;
     bool showRequest;
+    bool headlessRequest;
     bool unloadProfile;
     bool listControllers;
+    bool benchmarkMouseCurves;
 
     int startSetNumber;
     int controllerNumber;
@@ -135,6 +143,7 @@ class CommandLineUtility : public QObject
     QString controllerIDString;
     QString eventGenerator;
     QString currentLogFile;
+    QString benchmarkProfileLocation;
 
     Logger::LogLevel currentLogLevel;
 
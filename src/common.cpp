@@ -158,6 +158,8 @@ void lockInputDevices() { sdlWaitMutex.lock(); }
 
 void unlockInputDevices() { sdlWaitMutex.unlock(); }
 
+bool hasGraphicalInterface() { return qobject_cast<QApplication *>(QCoreApplication::instance()) != nullptr; }
+
 QIcon loadIcon(const QString &name, const QString &fallback_location)
 {
     qDebug() << " Application theme has icon named: " << name << " " << QIcon::hasThemeIcon(name);
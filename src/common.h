@@ -209,6 +209,12 @@ inline QString getProfileName(QFileInfo &profile)
 }
 
 void log_system_config();
+
+/**
+ * @brief Checks if the program runs with a graphical user interface.
+ *  False in headless mode, where no widgets or screens are available.
+ */
+bool hasGraphicalInterface();
 } // namespace PadderCommon
 
 Q_DECLARE_METATYPE(QThread *)
@@ -28,6 +28,7 @@
 #include <QVariant>
 #include <cmath>
 
+#include "common.h"
 #include "event.h"
 #include "eventhandlerfactory.h"
 #include "globalvariables.h"
@@ -289,6 +290,10 @@ void sendSpringEvent(PadderCommon::springModeInfo *fullSpring, PadderCommon::spr
 {
     PadderCommon::mouseHelperObj.mouseTimer.stop();
 
+    // Screen geometry is unknown in headless mode.
+    if (!PadderCommon::hasGraphicalInterface())
+        return;
+
     if (((fullSpring->displacementX >= -2.0) && (fullSpring->displacementX <= 1.0) && (fullSpring->displacementY >= -2.0) &&
          (fullSpring->displacementY <= 1.0)) ||
         (relativeSpring && ((relativeSpring->displacementX >= -2.0) && (relativeSpring->displacementX <= 1.0) &&
@@ -793,3 +798,12 @@ void sendKeybEvent(JoyButtonSlot *slot, bool pressed)
 {
     EventHandlerFactory::getInstance()->handler()->sendKeyboardEvent(slot, pressed);
 }
+
+/**
+ * @brief Collect all following output events of the calling thread so
+ *     they can be sent together by flushOutputBatch().
+ *     Calls may be nested, only the outermost flush sends the events.
+ */
+void beginOutputBatch() { EventHandlerFactory::getInstance()->handler()->beginOutputBatch(); }
+
+void flushOutputBatch() { EventHandlerFactory::getInstance()->handler()->flushOutputBatch(); }
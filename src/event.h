@@ -27,6 +27,9 @@ void sendevent(JoyButtonSlot *slot, bool pressed = true);
 void sendevent(int code1, int code2);
 void sendKeybEvent(JoyButtonSlot *slot, bool pressed = true);
 
+void beginOutputBatch();
+void flushOutputBatch();
+
 void sendSpringEvent(PadderCommon::springModeInfo *fullSpring, PadderCommon::springModeInfo *relativeSpring = 0,
                      int *const mousePosX = 0, int *const mousePos = 0);
 
@@ -66,3 +66,15 @@ void BaseEventHandler::sendMouseSpringEvent(int xDis, int yDis, int width, int h
 }
 
 void BaseEventHandler::sendTextEntryEvent(QString maintext) { Q_UNUSED(maintext); }
+
+/**
+ * @brief Do nothing by default. Handlers which are able to combine
+ *     multiple events into fewer system calls can override it.
+ */
+void BaseEventHandler::beginOutputBatch() {}
+
+/**
+ * @brief Do nothing by default. Events are sent immediately unless a
+ *     child class implements batching.
+ */
+void BaseEventHandler::flushOutputBatch() {}
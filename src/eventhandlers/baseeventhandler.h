@@ -55,6 +55,15 @@ class BaseEventHandler : public QObject
 
     virtual void sendTextEntryEvent(QString maintext);
 
+    /**
+     * @brief Start collecting events produced by the calling thread until flushOutputBatch() is called.
+     */
+    virtual void beginOutputBatch();
+    /**
+     * @brief Send all events collected since the matching beginOutputBatch() call.
+     */
+    virtual void flushOutputBatch();
+
     virtual QString getName() = 0;
     virtual QString getIdentifier() = 0;
     virtual void printPostMessages();
@@ -20,6 +20,7 @@
 #include <fcntl.h>
 #include <linux/input.h>
 #include <linux/uinput.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <QDebug>
@@ -27,6 +28,7 @@
 #include <QMessageBox>
 #include <QStringList>
 #include <QStringListIterator>
+#include <QThread>
 #include <QTimer>
 
 #include <antkeymapper.h>
@@ -53,6 +55,9 @@ UInputEventHandler::UInputEventHandler(QObject *parent)
 #if defined(Q_OS_UNIX)
     , is_problem_with_opening_uinput_present(false)
 #endif
+    , m_batch_thread(nullptr)
+    , m_batch_depth(0)
+    , m_saved_syscalls(0)
 {
     keyboardFileHandler = 0;
     mouseFileHandler = 0;
@@ -158,6 +163,10 @@ bool UInputEventHandler::cleanup() { return cleanupUinputEvHand(); }
 
 bool UInputEventHandler::cleanupUinputEvHand()
 {
+    m_output_batch.events.clear();
+    m_output_batch.frameCodes.clear();
+    m_output_batch.unbatchedWrites = 0;
+
     if (keyboardFileHandler > 0)
     {
         closeUInputDevice(keyboardFileHandler);
@@ -443,27 +452,134 @@ void UInputEventHandler::closeUInputDevice(int filehandle)
 
 void UInputEventHandler::write_uinput_event(int filehandle, int type, int code, int value, bool syn)
 {
-    struct input_event ev;
-    struct input_event ev2;
+    if (isBatchingOutput())
+    {
+        appendBatchEvent(filehandle, type, code, value, syn);
+        return;
+    }
+
+    struct input_event ev[2];
+
+    memset(ev, 0, sizeof(ev));
+    gettimeofday(&ev[0].time, nullptr);
+    ev[0].type = type;
+    ev[0].code = code;
+    ev[0].value = value;
+
+    if (syn)
+    {
+        ev[1].time = ev[0].time;
+        ev[1].type = EV_SYN;
+        ev[1].code = SYN_REPORT;
+        ev[1].value = 0;
+
+        m_saved_syscalls.fetchAndAddRelaxed(1);
+    }
+
+    write(filehandle, ev, (syn ? 2 : 1) * sizeof(struct input_event));
+}
+
+/**
+ * @brief Check if events written by the calling thread are collected in an output batch.
+ */
+bool UInputEventHandler::isBatchingOutput() const { return m_batch_thread.loadAcquire() == QThread::currentThread(); }
+
+/**
+ * @brief Add an event to the output batch.
+ *     The requested EV_SYN is deferred until the batch is written. A new
+ *     frame is only started early if the same event code was already written
+ *     since the last EV_SYN, so consecutive states of one key or axis are
+ *     not merged into a single frame. Switching to another device writes the
+ *     pending events first to keep the order between keyboard and mouse
+ *     events, e.g. for modifier + click combinations.
+ */
+void UInputEventHandler::appendBatchEvent(int filehandle, int type, int code, int value, bool syn)
+{
+    if (m_output_batch.filehandle != filehandle)
+    {
+        writeOutputBatch();
+        m_output_batch.filehandle = filehandle;
+    }
+
+    OutputBatch &batch = m_output_batch;
+    quint32 frameCode = (static_cast<quint32>(type) << 16) | static_cast<quint16>(code);
 
+    struct input_event ev;
     memset(&ev, 0, sizeof(struct input_event));
     gettimeofday(&ev.time, nullptr);
+
+    if (batch.frameCodes.contains(frameCode))
+    {
+        ev.type = EV_SYN;
+        ev.code = SYN_REPORT;
+        ev.value = 0;
+        batch.events.append(ev);
+        batch.frameCodes.clear();
+    }
+
     ev.type = type;
     ev.code = code;
     ev.value = value;
+    batch.events.append(ev);
+    batch.frameCodes.append(frameCode);
+    batch.unbatchedWrites += syn ? 2 : 1;
+}
 
-    write(filehandle, &ev, sizeof(struct input_event));
+/**
+ * @brief Start collecting events of the calling thread. Only one thread can
+ *     collect events at a time, events of other threads are still written
+ *     immediately.
+ */
+void UInputEventHandler::beginOutputBatch()
+{
+    QThread *currentThread = QThread::currentThread();
 
-    if (syn)
-    {
-        memset(&ev2, 0, sizeof(struct input_event));
-        gettimeofday(&ev2.time, nullptr);
-        ev2.type = EV_SYN;
-        ev2.code = SYN_REPORT;
-        ev2.value = 0;
+    if (m_batch_thread.testAndSetOrdered(nullptr, currentThread) || (m_batch_thread.loadAcquire() == currentThread))
+        m_batch_depth++;
+}
 
-        write(filehandle, &ev2, sizeof(struct input_event));
-    }
+/**
+ * @brief Write all events collected by the outermost output batch.
+ */
+void UInputEventHandler::flushOutputBatch()
+{
+    if (!isBatchingOutput() || (--m_batch_depth > 0))
+        return;
+
+    writeOutputBatch();
+    m_batch_thread.storeRelease(nullptr);
+}
+
+/**
+ * @brief Write pending batch events with a single system call, terminated
+ *     by one EV_SYN event.
+ */
+void UInputEventHandler::writeOutputBatch()
+{
+    OutputBatch &batch = m_output_batch;
+
+    if (batch.events.isEmpty())
+        return;
+
+    struct input_event syn;
+    memset(&syn, 0, sizeof(struct input_event));
+    syn.time = batch.events.last().time;
+    syn.type = EV_SYN;
+    syn.code = SYN_REPORT;
+    syn.value = 0;
+
+    struct iovec iov[2];
+    iov[0].iov_base = batch.events.data();
+    iov[0].iov_len = batch.events.size() * sizeof(struct input_event);
+    iov[1].iov_base = &syn;
+    iov[1].iov_len = sizeof(struct input_event);
+
+    writev(batch.filehandle, iov, 2);
+
+    m_saved_syscalls.fetchAndAddRelaxed(batch.unbatchedWrites - 1);
+    batch.events.clear();
+    batch.frameCodes.clear();
+    batch.unbatchedWrites = 0;
 }
 
 QString UInputEventHandler::getName() { return QString("uinput"); }
@@ -479,7 +595,7 @@ void UInputEventHandler::printPostMessages()
     {
         PRINT_STDERR() << lastErrorString;
 #if defined(Q_OS_UNIX)
-        if (is_problem_with_opening_uinput_present)
+        if (is_problem_with_opening_uinput_present && PadderCommon::hasGraphicalInterface())
         {
             QMessageBox msgBox;
             msgBox.setTextFormat(Qt::RichText);
@@ -592,3 +708,8 @@ int UInputEventHandler::getMouseFileHandler() { return mouseFileHandler; }
 int UInputEventHandler::getSpringMouseFileHandler() { return springMouseFileHandler; }
 
 const QString UInputEventHandler::getUinputDeviceLocation() { return uinputDeviceLocation; }
+
+/**
+ * @brief Gets the amount of write() calls avoided by combining events.
+ */
+qint64 UInputEventHandler::getSavedSyscalls() const { return m_saved_syscalls.loadAcquire(); }
@@ -21,6 +21,12 @@
 
 #include "baseeventhandler.h"
 
+#include <QAtomicInteger>
+#include <QAtomicPointer>
+#include <QVector>
+
+#include <linux/input.h>
+
 /**
  * @brief Input event handler class using uinput files
  *
@@ -54,10 +60,14 @@ class UInputEventHandler : public BaseEventHandler
 
     virtual void sendTextEntryEvent(QString maintext) override;
 
+    virtual void beginOutputBatch() override;
+    virtual void flushOutputBatch() override;
+
     int getKeyboardFileHandler();
     int getMouseFileHandler();
     int getSpringMouseFileHandler();
     const QString getUinputDeviceLocation();
+    qint64 getSavedSyscalls() const;
 
   protected:
     int openUInputHandle();
@@ -79,6 +89,7 @@ class UInputEventHandler : public BaseEventHandler
      * @param syn synchronize after event (emit additional event used for separation of events EV_SYN)
      */
     void write_uinput_event(int filehandle, int type, int code, int value, bool syn = true);
+    bool isBatchingOutput() const;
 
   private slots:
 #ifdef WITH_X11
@@ -86,6 +97,19 @@ class UInputEventHandler : public BaseEventHandler
 #endif
 
   private:
+    /**
+     * @brief Events collected for a single uinput device during an output batch.
+     */
+    struct OutputBatch
+    {
+        int filehandle = -1;
+        QVector<struct input_event> events;
+        // Event type and code pairs written since the last EV_SYN event.
+        QVector<quint32> frameCodes;
+        // Amount of write() calls the events would have needed without batching.
+        int unbatchedWrites = 0;
+    };
+
     int keyboardFileHandler;
     int mouseFileHandler;
     int springMouseFileHandler;
@@ -93,10 +117,16 @@ class UInputEventHandler : public BaseEventHandler
 #if defined(Q_OS_UNIX)
     bool is_problem_with_opening_uinput_present;
 #endif
+    OutputBatch m_output_batch;
+    QAtomicPointer<QThread> m_batch_thread;
+    int m_batch_depth;
+    QAtomicInteger<qint64> m_saved_syscalls;
 
     bool cleanupUinputEvHand();
     void testAndAppend(bool tested, QList<unsigned int> &tempList, unsigned int key);
     void initDevice(int &device, QString name, bool &result);
+    void appendBatchEvent(int filehandle, int type, int code, int value, bool syn);
+    void writeOutputBatch();
 };
 
 #endif // UINPUTEVENTHANDLER_H
@@ -56,6 +56,7 @@ GameController::GameController(SDL_GameController *controller, int deviceIndex,
         getJoystick_sets().insert(i, controllerset);
         enableSetConnections(controllerset);
     }
+    initStateSnapshot();
     INFO() << "Created new GameController:\n" << getDescription();
 }
 
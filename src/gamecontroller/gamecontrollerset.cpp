@@ -25,12 +25,12 @@
 #include "inputdevice.h"
 #include "joycontrolstick.h"
 #include "joysensor.h"
+#include "profilereader.h"
 #include "xml/joyaxisxml.h"
 #include "xml/joybuttonxml.h"
 #include "xml/joydpadxml.h"
 
 #include <QDebug>
-#include <QXmlStreamReader>
 
 GameControllerSet::GameControllerSet(InputDevice *device, int index, QObject *parent)
     : SetJoystick(device, index, false, parent)
@@ -109,7 +109,7 @@ void GameControllerSet::populateSticksDPad()
     getJoyAxis(SDL_CONTROLLER_AXIS_TRIGGERRIGHT)->setDefaultAxisName(tr("R Trigger"));
 }
 
-template <typename T> void readConf(T *x, QXmlStreamReader *xml)
+template <typename T> void readConf(T *x, ProfileReader *xml)
 {
     if (x != nullptr)
     {
@@ -120,7 +120,7 @@ template <typename T> void readConf(T *x, QXmlStreamReader *xml)
     }
 }
 
-void GameControllerSet::readConfig(QXmlStreamReader *xml)
+void GameControllerSet::readConfig(ProfileReader *xml)
 {
     if (xml->isStartElement() && (xml->name() == "set"))
     {
@@ -162,7 +162,7 @@ void GameControllerSet::readConfig(QXmlStreamReader *xml)
     }
 }
 
-void GameControllerSet::getElemFromXml(QString elemName, QXmlStreamReader *xml)
+void GameControllerSet::getElemFromXml(QString elemName, ProfileReader *xml)
 {
     int index = xml->attributes().value("index").toString().toInt();
 
@@ -240,13 +240,13 @@ void GameControllerSet::refreshAxes()
             (i == static_cast<int>(SDL_CONTROLLER_AXIS_TRIGGERRIGHT)))
         {
             GameControllerTrigger *trigger = new GameControllerTrigger(i, getIndex(), this, this);
-            getAxes()->insert(i, trigger);
+            insertAxis(i, trigger);
             enableAxisConnections(trigger);
             connect(trigger, &JoyAxis::hapticTriggerChanged, this, &GameControllerSet::applyHapticTrigger);
         } else
         {
             JoyAxis *axis = new JoyAxis(i, getIndex(), this, this);
-            getAxes()->insert(i, axis);
+            insertAxis(i, axis);
             enableAxisConnections(axis);
         }
     }
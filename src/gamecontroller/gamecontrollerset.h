@@ -23,7 +23,7 @@
 
 #include <SDL2/SDL_gamecontroller.h>
 
-class QXmlStreamReader;
+class ProfileReader;
 class InputDevice;
 
 /**
@@ -38,7 +38,7 @@ class GameControllerSet : public SetJoystick
 
     virtual void refreshAxes();
 
-    virtual void readConfig(QXmlStreamReader *xml);
+    virtual void readConfig(ProfileReader *xml);
 
   protected:
     void populateSticksDPad();
@@ -48,7 +48,7 @@ class GameControllerSet : public SetJoystick
     void applyHapticTrigger();
 
   private:
-    void getElemFromXml(QString elemName, QXmlStreamReader *xml);
+    void getElemFromXml(QString elemName, ProfileReader *xml);
     void resetSticks();
 };
 
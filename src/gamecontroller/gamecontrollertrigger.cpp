@@ -66,6 +66,8 @@ void GameControllerTrigger::reset()
     eventActive = false;
     maxZoneValue = GlobalVariables::GameControllerTrigger::AXISMAXZONE;
     throttle = this->DEFAULTTHROTTLE;
+    m_response_curve = JoyAxisCurve();
+    updateZoneRange();
 
     paxisbutton->reset();
     naxisbutton->reset();
@@ -57,6 +57,7 @@ const double GlobalVariables::JoyButton::DEFAULTWEIGHTMODIFIER = 0.2;
 const int GlobalVariables::JoyButton::MAXIMUMMOUSEHISTORYSIZE = 100;
 const double GlobalVariables::JoyButton::MAXIMUMWEIGHTMODIFIER = 1.0;
 const int GlobalVariables::JoyButton::MAXIMUMMOUSEREFRESHRATE = 16;
+const int GlobalVariables::JoyButton::MINIMUMMOUSEREFRESHPERIODUSEC = 250;
 int GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE = (5 * 20);
 const int GlobalVariables::JoyButton::DEFAULTIDLEMOUSEREFRESHRATE = 100;
 const double GlobalVariables::JoyButton::DEFAULTEXTRACCELVALUE = 2.0;
@@ -70,9 +71,8 @@ const int GlobalVariables::JoyButton::DEFAULTSPRINGRELEASERADIUS = 0;
 QHash<int, int> GlobalVariables::JoyButton::activeKeys;
 QHash<int, int> GlobalVariables::JoyButton::activeMouseButtons;
 
-// History buffers used for mouse smoothing routine.
-QList<double> GlobalVariables::JoyButton::mouseHistoryX;
-QList<double> GlobalVariables::JoyButton::mouseHistoryY;
+// History buffer used for mouse smoothing routine.
+MouseSmoothingHistory GlobalVariables::JoyButton::mouseHistory;
 
 // Carry over remainder of a cursor move for the next mouse event.
 double GlobalVariables::JoyButton::cursorRemainderX = 0.0;
@@ -83,6 +83,7 @@ double GlobalVariables::JoyButton::weightModifier = 0;
 int GlobalVariables::JoyButton::mouseHistorySize = 1;
 
 int GlobalVariables::JoyButton::mouseRefreshRate = 5;
+int GlobalVariables::JoyButton::mouseRefreshPeriodUsec = 5000;
 int GlobalVariables::JoyButton::springModeScreen = -1;
 int GlobalVariables::JoyButton::gamepadRefreshRate = 10;
 
@@ -92,6 +93,11 @@ const bool GlobalVariables::AntimicroSettings::defaultDisabledWinEnhanced = fals
 const bool GlobalVariables::AntimicroSettings::defaultAssociateProfiles = true;
 const int GlobalVariables::AntimicroSettings::defaultSpringScreen = -1;
 const int GlobalVariables::AntimicroSettings::defaultSDLGamepadPollRate = 10; // unsigned
+const bool GlobalVariables::AntimicroSettings::defaultSDLEventDrivenReader = false;
+const bool GlobalVariables::AntimicroSettings::defaultActivateEventsPerBatch = true;
+const bool GlobalVariables::AntimicroSettings::defaultCoalesceInputEvents = true;
+const bool GlobalVariables::AntimicroSettings::defaultAverageGyroSamples = true;
+const int GlobalVariables::AntimicroSettings::defaultNumberRecentProfiles = 5;
 
 // ---- INPUTDEVICE ---- //
 
@@ -100,6 +106,7 @@ const int GlobalVariables::InputDevice::DEFAULTKEYPRESSTIME = 100;
 const int GlobalVariables::InputDevice::RAISEDDEADZONE = 20000;
 const int GlobalVariables::InputDevice::DEFAULTKEYREPEATDELAY = 660; // 660 ms
 const int GlobalVariables::InputDevice::DEFAULTKEYREPEATRATE = 40;   // 40 ms. 25 times per second
+const int GlobalVariables::InputDevice::STATEREFRESHINTERVAL = 16; // 16 ms. About 60 times per second
 
 // QRegExp GlobalVariables::InputDevice::emptyGUID("^[0]+$");
 QRegExp GlobalVariables::InputDevice::emptyUniqueID("^[0]+$");
@@ -131,6 +138,7 @@ const int GlobalVariables::HapticTriggerPs5::FREQUENCY = 32;
 const QString GlobalVariables::X11Extras::mouseDeviceName = PadderCommon::mouseDeviceName;
 const QString GlobalVariables::X11Extras::keyboardDeviceName = PadderCommon::keyboardDeviceName;
 const QString GlobalVariables::X11Extras::xtestMouseDeviceName = QString("Virtual core XTEST pointer");
+const int GlobalVariables::X11Extras::WINDOWINFOCACHESIZE = 32;
 
 QString GlobalVariables::X11Extras::_customDisplayString = QString("");
 
@@ -158,6 +166,19 @@ const QString GlobalVariables::GameControllerTriggerButton::xmlName = "triggerbu
 // ---- InputDaemon ---- //
 
 const int GlobalVariables::InputDaemon::GAMECONTROLLERTRIGGERRELEASE = 16384;
+const int GlobalVariables::InputDaemon::EVENTBATCHREPORTINTERVAL = 1000;
+
+// ---- SDLEventReader ---- //
+
+const int GlobalVariables::SDLEventReader::EVENTWAITTIMEOUT = 50;
+
+// ---- MouseEventScheduler ---- //
+
+// Same bound as the settings, so a burst never ticks faster than the
+// fastest refresh rate that can be selected.
+const int GlobalVariables::MouseEventScheduler::MINIMUMINTERVALUSEC =
+    GlobalVariables::JoyButton::MINIMUMMOUSEREFRESHPERIODUSEC;
+const int GlobalVariables::MouseEventScheduler::STATISTICSREPORTINTERVAL = 5000;
 
 // ---- VDPad ---- //
 
@@ -230,3 +251,7 @@ const QString GlobalVariables::JoySensorButton::xmlName = "sensorbutton";
 // ---- JoyDPadButton ---- //
 
 const QString GlobalVariables::JoyDPadButton::xmlName = "dpadbutton";
+
+// ---- ProfilePool ---- //
+
+const int GlobalVariables::ProfilePool::CAPACITY = 16;
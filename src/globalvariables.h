@@ -19,6 +19,8 @@
 #ifndef GLOBALVARIABLES_H
 #define GLOBALVARIABLES_H
 
+#include "mousesmoothinghistory.h"
+
 #include <QList>
 #include <QObject>
 #include <QRegExp>
@@ -33,6 +35,8 @@ class JoyButton
     static int mouseHistorySize;
     // Get active mouse movement refresh rate
     static int mouseRefreshRate;
+    // Active mouse movement period in microseconds. Allows sub-millisecond periods.
+    static int mouseRefreshPeriodUsec;
     static int springModeScreen;
     // gamepad poll rate used by the application in ms
     static int gamepadRefreshRate;
@@ -78,6 +82,7 @@ class JoyButton
     static const int DEFAULTMOUSEHISTORYSIZE;
     static const int MAXIMUMMOUSEHISTORYSIZE;
     static const int MAXIMUMMOUSEREFRESHRATE;
+    static const int MINIMUMMOUSEREFRESHPERIODUSEC;
     static const int DEFAULTIDLEMOUSEREFRESHRATE;
     static const int MINCYCLERESETTIME;
     static const int MAXCYCLERESETTIME;
@@ -85,8 +90,7 @@ class JoyButton
 
     static QHash<int, int> activeKeys;
     static QHash<int, int> activeMouseButtons;
-    static QList<double> mouseHistoryX;
-    static QList<double> mouseHistoryY;
+    static MouseSmoothingHistory mouseHistory;
 };
 
 class AntimicroSettings
@@ -96,6 +100,11 @@ class AntimicroSettings
     static const bool defaultAssociateProfiles;
     static const int defaultSpringScreen;
     static const int defaultSDLGamepadPollRate;
+    static const bool defaultSDLEventDrivenReader;
+    static const bool defaultActivateEventsPerBatch;
+    static const bool defaultCoalesceInputEvents;
+    static const bool defaultAverageGyroSamples;
+    static const int defaultNumberRecentProfiles;
 };
 
 class InputDevice
@@ -106,6 +115,7 @@ class InputDevice
     static const int RAISEDDEADZONE;
     static const int DEFAULTKEYREPEATDELAY;
     static const int DEFAULTKEYREPEATRATE;
+    static const int STATEREFRESHINTERVAL;
 
     // static QRegExp emptyGUID;
     static QRegExp emptyUniqueID;
@@ -143,6 +153,7 @@ class X11Extras
     static const QString mouseDeviceName;
     static const QString keyboardDeviceName;
     static const QString xtestMouseDeviceName;
+    static const int WINDOWINFOCACHESIZE;
 
     static QString _customDisplayString;
 };
@@ -180,6 +191,25 @@ class InputDaemon
 {
   public:
     static const int GAMECONTROLLERTRIGGERRELEASE;
+    // Amount of processed batches between event batch statistics reports.
+    static const int EVENTBATCHREPORTINTERVAL;
+};
+
+class SDLEventReader
+{
+  public:
+    // Upper bound in ms for a single blocking wait before control is
+    // handed back to the worker thread event loop.
+    static const int EVENTWAITTIMEOUT;
+};
+
+class MouseEventScheduler
+{
+  public:
+    // Lower bound for a single tick period in microseconds.
+    static const int MINIMUMINTERVALUSEC;
+    // Amount of delivered ticks between timing statistics reports.
+    static const int STATISTICSREPORTINTERVAL;
 };
 
 class VDPad
@@ -279,6 +309,12 @@ class JoyDPadButton
     static const QString xmlName;
 };
 
+class ProfilePool
+{
+  public:
+    static const int CAPACITY;
+};
+
 } // namespace GlobalVariables
 
 #endif // GLOBALVARIABLES_H
@@ -19,6 +19,7 @@
 #include "advancestickassignmentdialog.h"
 #include "ui_advancestickassignmentdialog.h"
 
+#include "common.h"
 #include "globalvariables.h"
 #include "joycontrolstick.h"
 #include "joystick.h"
@@ -145,6 +146,8 @@ void AdvanceStickAssignmentDialog::checkForAxisAssignmentSticks(QWidget *comboBo
         {
             int originset = 0;
 
+            PadderCommon::inputDaemonMutex.lock();
+
             for (auto set = joystick->getJoystick_sets().begin(); set != joystick->getJoystick_sets().end(); ++set)
             {
                 SetJoystick *currentset = set.value();
@@ -165,6 +168,8 @@ void AdvanceStickAssignmentDialog::checkForAxisAssignmentSticks(QWidget *comboBo
                 originset++;
             }
 
+            PadderCommon::inputDaemonMutex.unlock();
+
             JoyControlStick *stick1 = joystick->getActiveSetJoystick()->getJoyStick(0);
             JoyControlStick *stick2 = joystick->getActiveSetJoystick()->getJoyStick(1);
             refreshStickConfiguration(stick1, stick2);
@@ -193,6 +198,8 @@ void AdvanceStickAssignmentDialog::changeStateVDPadWidgets(bool enabledVDPads)
 
     int originset = 0;
 
+    PadderCommon::inputDaemonMutex.lock();
+
     for (auto set = joystick->getJoystick_sets().begin(); set != joystick->getJoystick_sets().end(); ++set)
     {
         SetJoystick *currentset = set.value();
@@ -207,6 +214,8 @@ void AdvanceStickAssignmentDialog::changeStateVDPadWidgets(bool enabledVDPads)
 
         originset++;
     }
+
+    PadderCommon::inputDaemonMutex.unlock();
 }
 
 void AdvanceStickAssignmentDialog::changeStateStickOneWidgets(bool enabled)
@@ -232,11 +241,15 @@ void AdvanceStickAssignmentDialog::changeStateStickOneWidgets(bool enabled)
         ui->enableTwoCheckBox->setChecked(false);
         ui->quickAssignStick1PushButton->setEnabled(false);
 
+        PadderCommon::inputDaemonMutex.lock();
+
         if (joystick->getActiveSetJoystick()->getJoyStick(1) != nullptr)
             joystick->removeControlStick(1);
 
         if (joystick->getActiveSetJoystick()->getJoyStick(0) != nullptr)
             joystick->removeControlStick(0);
+
+        PadderCommon::inputDaemonMutex.unlock();
     }
 }
 
@@ -255,6 +268,8 @@ void AdvanceStickAssignmentDialog::changeStateStickTwoWidgets(bool enabled)
         ui->yAxisTwoComboBox->setCurrentIndex(0);
         ui->quickAssignStick2PushButton->setEnabled(false);
 
+        PadderCommon::inputDaemonMutex.lock();
+
         if (joystick->getActiveSetJoystick()->getJoyStick(1) != nullptr)
         {
             for (auto set = joystick->getJoystick_sets().begin(); set != joystick->getJoystick_sets().end(); ++set)
@@ -262,6 +277,8 @@ void AdvanceStickAssignmentDialog::changeStateStickTwoWidgets(bool enabled)
                 set.value()->removeControlStick(1);
             }
         }
+
+        PadderCommon::inputDaemonMutex.unlock();
     }
 }
 
@@ -39,6 +39,8 @@
 JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *parent)
     : QDialog(parent)
     , ui(new Ui::JoystickStatusWindow)
+    , m_accel_axes{nullptr, nullptr, nullptr}
+    , m_gyro_axes{nullptr, nullptr, nullptr}
 {
     ui->setupUi(this);
     setAttribute(Qt::WA_DeleteOnClose);
@@ -132,7 +134,8 @@ JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *paren
             hbox->addSpacing(10);
             axesBox->addLayout(hbox);
 
-            connect(axis, &JoyAxis::moved, axisBar, &QProgressBar::setValue);
+            m_axis_bars.resize(qMax(m_axis_bars.size(), i + 1));
+            m_axis_bars[i] = axisBar;
         }
     }
 
@@ -151,6 +154,8 @@ JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *paren
         {
             JoyButtonStatusBox *statusbox = new JoyButtonStatusBox(button);
             statusbox->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+            m_button_boxes.resize(qMax(m_button_boxes.size(), i + 1));
+            m_button_boxes[i] = statusbox;
 
             buttonsGrid->addWidget(statusbox, currentRow, currentColumn);
             currentColumn++;
@@ -185,8 +190,17 @@ JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *paren
             hbox->addSpacing(10);
             hatsBox->addLayout(hbox);
 
-            connect(dpad, &JoyDPad::active, dpadBar, &QProgressBar::setValue);
-            connect(dpad, &JoyDPad::released, dpadBar, &QProgressBar::setValue);
+            if (i < joystick->getNumberRawHats())
+            {
+                m_hat_bars.resize(qMax(m_hat_bars.size(), i + 1));
+                m_hat_bars[i] = dpadBar;
+            } else
+            {
+                // The D-pad of a game controller is built from buttons and
+                // has no raw hat in the state snapshot.
+                connect(dpad, &JoyDPad::active, dpadBar, &QProgressBar::setValue);
+                connect(dpad, &JoyDPad::released, dpadBar, &QProgressBar::setValue);
+            }
         }
     }
 
@@ -248,14 +262,6 @@ JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *paren
                 hbox->addSpacing(10);
                 sensorsBox->addLayout(hbox);
             }
-
-            if (type == ACCELEROMETER)
-            {
-                connect(sensor, &JoySensor::moved, this, &JoystickStatusWindow::updateAccelerometerValues);
-            } else
-            {
-                connect(sensor, &JoySensor::moved, this, &JoystickStatusWindow::updateGyroscopeValues);
-            }
         }
     }
 
@@ -300,6 +306,10 @@ JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *paren
 
     connect(joystick, &InputDevice::destroyed, this, &JoystickStatusWindow::obliterate);
     connect(this, &JoystickStatusWindow::finished, this, &JoystickStatusWindow::restoreButtonStates);
+
+    // Poll element states at display rate instead of reacting to every input event.
+    connect(&m_refresh_timer, &QTimer::timeout, this, &JoystickStatusWindow::refreshStates);
+    m_refresh_timer.start(GlobalVariables::InputDevice::STATEREFRESHINTERVAL);
 }
 
 JoystickStatusWindow::~JoystickStatusWindow() { delete ui; }
@@ -320,22 +330,59 @@ void JoystickStatusWindow::restoreButtonStates(int code)
 void JoystickStatusWindow::obliterate() { this->done(QDialogButtonBox::DestructiveRole); }
 
 /**
- * @brief Accelerometer "moved" event handler
- *  Updates raw accelerometer values on the screen.
+ * @brief Updates all displayed element states from the state snapshot
+ *  of the joystick if it changed since the last refresh.
+ */
+void JoystickStatusWindow::refreshStates()
+{
+    if (!joystick->getStateSnapshot().read(m_state))
+        return;
+
+    for (int i = 0; i < m_axis_bars.size() && i < m_state.axes.size(); i++)
+    {
+        if (m_axis_bars.at(i) != nullptr)
+            m_axis_bars.at(i)->setValue(m_state.axes.at(i));
+    }
+
+    for (int i = 0; i < m_button_boxes.size() && i < m_state.buttons.size(); i++)
+    {
+        if (m_button_boxes.at(i) != nullptr)
+            m_button_boxes.at(i)->setFlashing(m_state.buttons.at(i));
+    }
+
+    for (int i = 0; i < m_hat_bars.size() && i < m_state.hats.size(); i++)
+    {
+        if (m_hat_bars.at(i) != nullptr)
+            m_hat_bars.at(i)->setValue(m_state.hats.at(i));
+    }
+
+    const float *accel = m_state.sensors[ACCELEROMETER];
+    const float *gyro = m_state.sensors[GYROSCOPE];
+    updateAccelerometerValues(accel[0], accel[1], accel[2]);
+    updateGyroscopeValues(gyro[0], gyro[1], gyro[2]);
+}
+
+/**
+ * @brief Updates raw accelerometer values on the screen.
  */
 void JoystickStatusWindow::updateAccelerometerValues(float valueX, float valueY, float valueZ)
 {
+    if (m_accel_axes[0] == nullptr)
+        return;
+
     m_accel_axes[0]->setValue(valueX * 1000);
     m_accel_axes[1]->setValue(valueY * 1000);
     m_accel_axes[2]->setValue(valueZ * 1000);
 }
 
 /**
- * @brief Gyroscope "moved" event handler
- *  Updates raw gyroscope values on the screen.
+ * @brief Updates raw gyroscope values on the screen.
  */
 void JoystickStatusWindow::updateGyroscopeValues(float valueX, float valueY, float valueZ)
 {
+    if (m_gyro_axes[0] == nullptr)
+        return;
+
     m_gyro_axes[0]->setValue(JoySensor::radToDeg(valueX) * 1000);
     m_gyro_axes[1]->setValue(JoySensor::radToDeg(valueY) * 1000);
     m_gyro_axes[2]->setValue(JoySensor::radToDeg(valueZ) * 1000);
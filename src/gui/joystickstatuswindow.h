@@ -19,9 +19,14 @@
 #ifndef JOYSTICKSTATUSWINDOW_H
 #define JOYSTICKSTATUSWINDOW_H
 
+#include "inputdevicestatesnapshot.h"
+
 #include <QDialog>
+#include <QTimer>
+#include <QVector>
 
 class InputDevice;
+class JoyButtonStatusBox;
 class QProgressBar;
 class QWidget;
 
@@ -47,14 +52,21 @@ class JoystickStatusWindow : public QDialog
     Ui::JoystickStatusWindow *ui;
 
     InputDevice *joystick;
+    QVector<QProgressBar *> m_axis_bars;
+    QVector<JoyButtonStatusBox *> m_button_boxes;
+    QVector<QProgressBar *> m_hat_bars;
     QProgressBar *m_accel_axes[3];
     QProgressBar *m_gyro_axes[3];
+    InputDeviceStateSnapshot::State m_state;
+    QTimer m_refresh_timer;
+
+    void updateAccelerometerValues(float valueX, float valueY, float valueZ);
+    void updateGyroscopeValues(float valueX, float valueY, float valueZ);
 
   private slots:
     void restoreButtonStates(int code);
     void obliterate();
-    void updateAccelerometerValues(float valueX, float valueY, float valueZ);
-    void updateGyroscopeValues(float valueX, float valueY, float valueZ);
+    void refreshStates();
 };
 
 #endif // JOYSTICKSTATUSWINDOW_H
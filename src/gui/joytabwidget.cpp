@@ -36,6 +36,7 @@
 #include "joydpad.h"
 #include "joysensor.h"
 #include "joystick.h"
+#include "profilesaver.h"
 #include "quicksetdialog.h"
 #include "sensorpushbuttongroup.h"
 #include "setnamesdialog.h"
@@ -73,6 +74,7 @@ JoyTabWidget::JoyTabWidget(InputDevice *joystick, AntiMicroSettings *settings, Q
     , m_joystick(joystick)
     , m_settings(settings)
     , tabHelper(joystick)
+    , m_filled_set_pages(GlobalVariables::InputDevice::NUMBER_JOYSETS)
 {
     tabHelper.moveToThread(joystick->thread());
 
@@ -509,6 +511,7 @@ JoyTabWidget::JoyTabWidget(InputDevice *joystick, AntiMicroSettings *settings, Q
     connect(joystick, &InputDevice::profileUpdated, this, &JoyTabWidget::displayProfileEditNotification);
 
     connect(joystick, &InputDevice::requestProfileLoad, this, &JoyTabWidget::loadConfigFile, Qt::QueuedConnection);
+    connect(ProfileSaver::getInstance(), &ProfileSaver::saveFinished, this, &JoyTabWidget::profileSaveFinished);
 
     reconnectCheckUnsavedEvent();
     reconnectMainComboBoxEvents();
@@ -526,7 +529,8 @@ void JoyTabWidget::openConfigFileDialog()
 {
     m_settings->getLock()->lock();
 
-    int numberRecentProfiles = m_settings->value("NumberRecentProfiles", DEFAULTNUMBERPROFILES).toInt();
+    int numberRecentProfiles =
+        m_settings->value("NumberRecentProfiles", GlobalVariables::AntimicroSettings::defaultNumberRecentProfiles).toInt();
     QString lookupDir = PadderCommon::preferredProfileDir(m_settings);
 
     QString filename = QFileDialog::getOpenFileName(this, tr("Open Config"), lookupDir, tr("Config Files (*.amgp *.xml)"));
@@ -580,22 +584,32 @@ void JoyTabWidget::openConfigFileDialog()
 
 /**
  * @brief Create and render all push buttons corresponding to joystick
- *     controls for all sets.
+ *     controls for the displayed set. Pages of other sets are filled
+ *     when they are shown for the first time.
  */
 void JoyTabWidget::fillButtons()
 {
     m_joystick->establishPropertyUpdatedConnection();
     connect(m_joystick, &InputDevice::setChangeActivated, this, &JoyTabWidget::changeCurrentSet, Qt::QueuedConnection);
 
-    for (int i = 0; i < GlobalVariables::InputDevice::NUMBER_JOYSETS; i++)
-    {
-        SetJoystick *currentSet = m_joystick->getSetJoystick(i);
-        fillSetButtons(currentSet);
-    }
+    fillSetPage(stackedWidget_2->currentIndex());
+    fillSetPage(m_joystick->getActiveSetNumber());
 
     refreshCopySetActions();
 }
 
+/**
+ * @brief Create the push buttons of a set page unless it was already filled.
+ */
+void JoyTabWidget::fillSetPage(int index)
+{
+    if ((index < 0) || (index >= m_filled_set_pages.size()) || m_filled_set_pages.testBit(index))
+        return;
+
+    m_filled_set_pages.setBit(index);
+    fillSetButtons(m_joystick->getSetJoystick(index));
+}
+
 void JoyTabWidget::showButtonDialog()
 {
     JoyButtonWidget *buttonWidget = qobject_cast<JoyButtonWidget *>(sender()); // static_cast
@@ -630,7 +644,8 @@ void JoyTabWidget::saveConfigFile()
 
     m_settings->getLock()->lock();
 
-    int numberRecentProfiles = m_settings->value("NumberRecentProfiles", DEFAULTNUMBERPROFILES).toInt();
+    int numberRecentProfiles =
+        m_settings->value("NumberRecentProfiles", GlobalVariables::AntimicroSettings::defaultNumberRecentProfiles).toInt();
     QString filename = QString();
     if (index == 0)
     {
@@ -676,6 +691,7 @@ void JoyTabWidget::saveConfigFile()
             PRINT_STDERR() << writer->getErrorString() << "\n";
         } else
         {
+            m_pending_saves.insert(fileinfo.absoluteFilePath());
             int existingIndex = configBox->findData(fileinfo.absoluteFilePath());
 
             if (existingIndex == -1)
@@ -722,6 +738,30 @@ void JoyTabWidget::saveConfigFile()
     }
 }
 
+/**
+ * @brief Reports errors of profile saves which were written in the background.
+ */
+void JoyTabWidget::profileSaveFinished(QString fileLocation, bool success, QString errorString)
+{
+    if (!m_pending_saves.remove(fileLocation) || success)
+        return;
+
+    // Changes are not on disk, so mark them as unsaved again.
+    m_joystick->profileEdited();
+
+    if (this->window()->isEnabled())
+    {
+        QMessageBox msg;
+        msg.setStandardButtons(QMessageBox::Close);
+        msg.setText(errorString);
+        msg.setModal(true);
+        msg.exec();
+    } else
+    {
+        PRINT_STDERR() << errorString << "\n";
+    }
+}
+
 void JoyTabWidget::resetJoystick()
 {
     QMessageBox msg;
@@ -797,7 +837,8 @@ void JoyTabWidget::saveAsConfig()
 
     m_settings->getLock()->lock();
 
-    int numberRecentProfiles = m_settings->value("NumberRecentProfiles", DEFAULTNUMBERPROFILES).toInt();
+    int numberRecentProfiles =
+        m_settings->value("NumberRecentProfiles", GlobalVariables::AntimicroSettings::defaultNumberRecentProfiles).toInt();
     QString filename = QString();
     if (index == 0)
     {
@@ -851,6 +892,7 @@ void JoyTabWidget::saveAsConfig()
             PRINT_STDERR() << writer->getErrorString() << "\n";
         } else
         {
+            m_pending_saves.insert(fileinfo.absoluteFilePath());
             int existingIndex = configBox->findData(fileinfo.absoluteFilePath());
             if (existingIndex == -1)
             {
@@ -1119,7 +1161,8 @@ void JoyTabWidget::loadSettings(bool forceRefresh)
         changeNameDisplay(shouldisplaynames);
     }
 
-    int numberRecentProfiles = m_settings->value("NumberRecentProfiles", DEFAULTNUMBERPROFILES).toInt();
+    int numberRecentProfiles =
+        m_settings->value("NumberRecentProfiles", GlobalVariables::AntimicroSettings::defaultNumberRecentProfiles).toInt();
     bool autoOpenLastProfile = m_settings->value("AutoOpenLastProfile", true).toBool();
 
     m_settings->beginGroup("Controllers");
@@ -1278,6 +1321,7 @@ void JoyTabWidget::changeCurrentSet(int index)
     }
 
     m_joystick->setActiveSetNumber(index);
+    fillSetPage(index);
     stackedWidget_2->setCurrentIndex(index);
 
     switch (index)
@@ -1348,7 +1392,9 @@ void JoyTabWidget::loadConfigFile(QString fileLocation)
 
     if (!m_joystick->isDeviceEdited())
     {
-        int numberRecentProfiles = m_settings->value("NumberRecentProfiles", DEFAULTNUMBERPROFILES).toInt();
+        int numberRecentProfiles =
+            m_settings->value("NumberRecentProfiles", GlobalVariables::AntimicroSettings::defaultNumberRecentProfiles)
+                .toInt();
         QFileInfo fileinfo(fileLocation);
         if (fileinfo.exists() && ((fileinfo.suffix() == "xml") || (fileinfo.suffix() == "amgp")))
         {
@@ -1409,9 +1455,14 @@ void JoyTabWidget::removeCurrentButtons()
 
     for (int i = 0; i < GlobalVariables::InputDevice::NUMBER_JOYSETS; i++)
     {
+        if (!m_filled_set_pages.testBit(i))
+            continue;
+
         SetJoystick *currentSet = m_joystick->getSetJoystick(i);
         removeSetButtons(currentSet);
     }
+
+    m_filled_set_pages.fill(false);
 }
 
 InputDevice *JoyTabWidget::getJoystick() { return m_joystick; }
@@ -19,7 +19,9 @@
 #ifndef JOYTABWIDGET_H
 #define JOYTABWIDGET_H
 
+#include <QBitArray>
 #include <QLabel>
+#include <QSet>
 #include <QWidget>
 
 #include <SDL_joystick.h>
@@ -85,10 +87,9 @@ class JoyTabWidget : public QWidget
     void reconnectCheckUnsavedEvent();
     void fillSetButtons(SetJoystick *set);   // JoyTabWidgetSets class
     void removeSetButtons(SetJoystick *set); // JoyTabWidgetSets class
+    void fillSetPage(int index);             // JoyTabWidgetSets class
     bool isKeypadUnlocked();
 
-    static const int DEFAULTNUMBERPROFILES = 5;
-
   signals:
     void joystickConfigChanged(int index); // JoyTabSettings class
     void joystickAxisRefreshLabels(int axisIndex);
@@ -108,6 +109,7 @@ class JoyTabWidget : public QWidget
 
   private slots:
     void saveConfigFile(); // JoyTabSettings class
+    void profileSaveFinished(QString fileLocation, bool success, QString errorString); // JoyTabSettings class
     void resetJoystick();
     void saveAsConfig();             // JoyTabSettings class
     void removeConfig();             // JoyTabSettings class
@@ -228,6 +230,10 @@ class JoyTabWidget : public QWidget
 
     SDL_JoystickPowerLevel m_old_power_level = SDL_JOYSTICK_POWER_UNKNOWN;
     QTimer *m_battery_updater;
+    // Set pages are only populated with widgets once they are shown.
+    QBitArray m_filled_set_pages;
+    // Profiles saved from this tab which are still being written.
+    QSet<QString> m_pending_saves;
 };
 
 #endif // JOYTABWIDGET_H
@@ -83,6 +83,8 @@ MainSettingsDialog::MainSettingsDialog(AntiMicroSettings *settings, QList<InputD
     QString defaultProfileDir = settings->value("DefaultProfileDir", "").toString();
     int numberRecentProfiles = settings->value("NumberRecentProfiles", 5).toInt();
     bool closeToTray = settings->value("CloseToTray", false).toBool();
+    bool gamepadEventDriven =
+        settings->value("GamepadEventDriven", GlobalVariables::AntimicroSettings::defaultSDLEventDrivenReader).toBool();
 
     if (!defaultProfileDir.isEmpty() && QDir(defaultProfileDir).exists())
     {
@@ -99,6 +101,8 @@ MainSettingsDialog::MainSettingsDialog(AntiMicroSettings *settings, QList<InputD
         ui->closeToTrayCheckBox->setChecked(true);
     }
 
+    ui->gamepadEventDrivenCheckBox->setChecked(gamepadEventDriven);
+
     changePresetLanguage();
 
 #ifdef Q_OS_WIN
@@ -247,12 +251,18 @@ MainSettingsDialog::MainSettingsDialog(AntiMicroSettings *settings, QList<InputD
         ui->weightModifierDoubleSpinBox->setValue(weightModifier);
     }
 
+    // Sub-millisecond periods are only offered down to the supported minimum.
+    for (int period = GlobalVariables::JoyButton::MINIMUMMOUSEREFRESHPERIODUSEC; period < 1000; period *= 2)
+    {
+        ui->mouseRefreshRateComboBox->addItem(QString("%1 ms").arg(period * 0.001), period);
+    }
+
     for (int i = 1; i <= GlobalVariables::JoyButton::MAXIMUMMOUSEREFRESHRATE; i++)
     {
-        ui->mouseRefreshRateComboBox->addItem(QString("%1 ms").arg(i), i);
+        ui->mouseRefreshRateComboBox->addItem(QString("%1 ms").arg(i), i * 1000);
     }
 
-    int refreshIndex = ui->mouseRefreshRateComboBox->findData(GlobalVariables::JoyButton::mouseRefreshRate);
+    int refreshIndex = ui->mouseRefreshRateComboBox->findData(GlobalVariables::JoyButton::mouseRefreshPeriodUsec);
     if (refreshIndex >= 0)
     {
         ui->mouseRefreshRateComboBox->setCurrentIndex(refreshIndex);
@@ -677,22 +687,22 @@ void MainSettingsDialog::saveNewSettings()
         {
             JoyButton::setMouseHistorySize(historySize, GlobalVariables::JoyButton::MAXIMUMMOUSEHISTORYSIZE,
                                            GlobalVariables::JoyButton::mouseHistorySize,
-                                           &GlobalVariables::JoyButton::mouseHistoryX,
-                                           &GlobalVariables::JoyButton::mouseHistoryY);
+                                           &GlobalVariables::JoyButton::mouseHistory);
         }
 
         if (weightModifier != 0.0)
         {
             JoyButton::setWeightModifier(weightModifier, GlobalVariables::JoyButton::MAXIMUMWEIGHTMODIFIER,
-                                         GlobalVariables::JoyButton::weightModifier);
+                                         GlobalVariables::JoyButton::weightModifier,
+                                         &GlobalVariables::JoyButton::mouseHistory);
         }
     } else
     {
         JoyButton::setMouseHistorySize(
             1, GlobalVariables::JoyButton::MAXIMUMMOUSEHISTORYSIZE, GlobalVariables::JoyButton::mouseHistorySize,
-            &GlobalVariables::JoyButton::mouseHistoryX, &GlobalVariables::JoyButton::mouseHistoryY);
+            &GlobalVariables::JoyButton::mouseHistory);
         JoyButton::setWeightModifier(0.0, GlobalVariables::JoyButton::MAXIMUMWEIGHTMODIFIER,
-                                     GlobalVariables::JoyButton::weightModifier);
+                                     GlobalVariables::JoyButton::weightModifier, &GlobalVariables::JoyButton::mouseHistory);
     }
 
     if (historySize > 0)
@@ -706,15 +716,15 @@ void MainSettingsDialog::saveNewSettings()
     }
 
     int refreshIndex = ui->mouseRefreshRateComboBox->currentIndex();
-    int mouseRefreshRate = ui->mouseRefreshRateComboBox->itemData(refreshIndex).toInt();
-    if (mouseRefreshRate != GlobalVariables::JoyButton::mouseRefreshRate)
+    int mouseRefreshPeriod = ui->mouseRefreshRateComboBox->itemData(refreshIndex).toInt();
+    if (mouseRefreshPeriod != GlobalVariables::JoyButton::mouseRefreshPeriodUsec)
     {
-        settings->setValue("Mouse/RefreshRate", mouseRefreshRate);
-        JoyButton::setMouseRefreshRate(mouseRefreshRate, GlobalVariables::JoyButton::mouseRefreshRate,
-                                       GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE, JoyButton::getMouseHelper(),
-                                       &GlobalVariables::JoyButton::mouseHistoryX,
-                                       &GlobalVariables::JoyButton::mouseHistoryY, JoyButton::getTestOldMouseTime(),
-                                       JoyButton::getStaticMouseEventTimer());
+        settings->setValue("Mouse/RefreshRate", qMax(1, mouseRefreshPeriod / 1000));
+        settings->setValue("Mouse/RefreshPeriodUsec", mouseRefreshPeriod);
+        JoyButton::setMouseRefreshPeriod(mouseRefreshPeriod, GlobalVariables::JoyButton::mouseRefreshRate,
+                                         GlobalVariables::JoyButton::mouseRefreshPeriodUsec, JoyButton::getMouseHelper(),
+                                         &GlobalVariables::JoyButton::mouseHistory, JoyButton::getTestOldMouseTime(),
+                                         JoyButton::getStaticMouseEventTimer());
     }
 
     int springIndex = ui->springScreenComboBox->currentIndex();
@@ -731,6 +741,14 @@ void MainSettingsDialog::saveNewSettings()
         settings->setValue("GamepadPollRate", QString::number(gamepadPollRate));
     }
 
+    bool gamepadEventDriven = ui->gamepadEventDrivenCheckBox->isChecked();
+    if (gamepadEventDriven !=
+        settings->value("GamepadEventDriven", GlobalVariables::AntimicroSettings::defaultSDLEventDrivenReader).toBool())
+    {
+        JoyButton::getMouseHelper()->carryGamepadEventDrivenUpdate(gamepadEventDriven);
+        settings->setValue("GamepadEventDriven", gamepadEventDriven ? "1" : "0");
+    }
+
     // Advanced Tab
     settings->setValue("LogFile", ui->logFilePathEdit->text());
     int logLevel = ui->logLevelComboBox->currentIndex();
@@ -1949,6 +1967,7 @@ void MainSettingsDialog::resetGeneralSett()
         ui->gamepadPollRateComboBox->setCurrentIndex(gamepadPollIndex);
     }
 
+    ui->gamepadEventDrivenCheckBox->setChecked(GlobalVariables::AntimicroSettings::defaultSDLEventDrivenReader);
     ui->closeToTrayCheckBox->setChecked(false);
     ui->attachNumKeypadCheckbox->setChecked(false);
     ui->launchAtWinStartupCheckBox->setChecked(false);
@@ -2023,7 +2042,7 @@ void MainSettingsDialog::resetMouseSett()
     ui->weightModifierDoubleSpinBox->setValue(0.20);
     ui->weightModifierDoubleSpinBox->setEnabled(false);
 
-    int refreshIndex = ui->mouseRefreshRateComboBox->findData(GlobalVariables::JoyButton::mouseRefreshRate);
+    int refreshIndex = ui->mouseRefreshRateComboBox->findData(GlobalVariables::JoyButton::mouseRefreshPeriodUsec);
 
     if (refreshIndex >= 0)
     {
@@ -142,7 +142,7 @@ void QuickSetDialog::connectSticksForDialog(SetJoystick *currentset)
 
 void QuickSetDialog::connectAxesForDialog(SetJoystick *currentset)
 {
-    QListIterator<JoyAxis *> axesList = currentset->getAxes()->values();
+    QListIterator<JoyAxis *> axesList = currentset->getAxes().values();
 
     while (axesList.hasNext())
     {
@@ -379,7 +379,7 @@ void QuickSetDialog::restoreSticksStates(SetJoystick *currentset)
 
 void QuickSetDialog::restoreAxesStates(SetJoystick *currentset)
 {
-    QListIterator<JoyAxis *> axesList = currentset->getAxes()->values();
+    QListIterator<JoyAxis *> axesList = currentset->getAxes().values();
 
     while (axesList.hasNext())
     {
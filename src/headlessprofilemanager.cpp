@@ -0,0 +1,518 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "headlessprofilemanager.h"
+
+#include "antimicrosettings.h"
+#include "commandlineutility.h"
+#include "common.h"
+#include "globalvariables.h"
+#include "inputdevice.h"
+#include "logger.h"
+#include "uihelpers/joytabwidgethelper.h"
+#include "xmlconfigreader.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QMetaObject>
+#include <QThread>
+
+namespace {
+/**
+ * @brief Converts a profile location to the form stored in the settings file.
+ */
+QString settingsLocation(const QString &location)
+{
+    QString outputFilename = location;
+
+#if defined(Q_OS_WIN) && defined(WIN_PORTABLE_PACKAGE)
+    QFileInfo profileBaseFile(location);
+    if (profileBaseFile.isAbsolute())
+    {
+        QDir tempDir = profileBaseFile.dir();
+        tempDir.cdUp();
+        if (tempDir.path() == qApp->applicationDirPath())
+            outputFilename = QString("%1/%2").arg(profileBaseFile.dir().dirName()).arg(profileBaseFile.fileName());
+    }
+#endif
+
+    return outputFilename;
+}
+
+/**
+ * @brief Gets the connection type to invoke a slot of an object, which may
+ *  live in the input thread, and wait for it to finish.
+ */
+Qt::ConnectionType blockingConnection(QObject *receiver)
+{
+    return (receiver->thread() == QThread::currentThread()) ? Qt::DirectConnection : Qt::BlockingQueuedConnection;
+}
+} // namespace
+
+/**
+ * @param[in] applyProfiles If false, only the profile selection is tracked
+ *  and written to the settings without configuring the devices. Used by an
+ *  instance which forwards its command line to a running instance.
+ */
+HeadlessProfileManager::HeadlessProfileManager(QMap<SDL_JoystickID, InputDevice *> *joysticks,
+                                               CommandLineUtility *cmdutility, AntiMicroSettings *settings,
+                                               bool applyProfiles, QObject *parent)
+    : QObject(parent)
+    , m_joysticks(joysticks)
+    , m_cmdutility(cmdutility)
+    , m_settings(settings)
+    , m_apply_profiles(applyProfiles)
+{
+}
+
+HeadlessProfileManager::~HeadlessProfileManager() { clearDevices(); }
+
+void HeadlessProfileManager::fillDevices() { fillDevicesMap(m_joysticks); }
+
+/**
+ * @brief Starts tracking the given devices and applies their last selected profiles.
+ */
+void HeadlessProfileManager::fillDevicesMap(QMap<SDL_JoystickID, InputDevice *> *joysticks)
+{
+    clearDevices();
+
+    // Order devices by their index rather than the joystick ID.
+    QMap<int, InputDevice *> ordered;
+    for (auto iter = joysticks->cbegin(); iter != joysticks->cend(); ++iter)
+        ordered.insert(iter.value()->getJoyNumber(), iter.value());
+
+    for (InputDevice *device : ordered)
+    {
+        DeviceProfiles *profiles = new DeviceProfiles;
+        profiles->device = device;
+        profiles->helper = new JoyTabWidgetHelper(device);
+        profiles->helper->moveToThread(device->thread());
+        m_devices.append(profiles);
+    }
+
+    loadAppConfig();
+}
+
+void HeadlessProfileManager::addDevice(InputDevice *device)
+{
+    DeviceProfiles *profiles = new DeviceProfiles;
+    profiles->device = device;
+    profiles->helper = new JoyTabWidgetHelper(device);
+    profiles->helper->moveToThread(device->thread());
+
+    int position = 0;
+    while ((position < m_devices.size()) && (m_devices.at(position)->device->getJoyNumber() < device->getJoyNumber()))
+        position++;
+
+    m_devices.insert(position, profiles);
+    loadDeviceSettings(profiles);
+}
+
+void HeadlessProfileManager::removeDevice(SDL_JoystickID deviceID)
+{
+    for (int i = 0; i < m_devices.size(); i++)
+    {
+        DeviceProfiles *profiles = m_devices.at(i);
+        if (deviceID == profiles->device->getSDLJoystickID())
+        {
+            // Save most recent profile list to settings before removing the device.
+            saveDeviceSettings(profiles);
+            m_settings->sync();
+
+            m_devices.removeAt(i);
+            QMetaObject::invokeMethod(profiles->device, "finalRemoval");
+            profiles->helper->deleteLater();
+            delete profiles;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Applies profile, unload and set options given on the command line.
+ */
+void HeadlessProfileManager::alterConfigFromSettings()
+{
+    if (m_cmdutility->hasProfile())
+    {
+        if (m_cmdutility->hasControllerNumber())
+            loadConfigFile(m_cmdutility->getProfileLocation(), m_cmdutility->getControllerNumber());
+        else if (m_cmdutility->hasControllerID())
+            loadConfigFile(m_cmdutility->getProfileLocation(), m_cmdutility->getControllerID());
+        else
+            loadConfigFile(m_cmdutility->getProfileLocation());
+    }
+
+    for (ControllerOptionsInfo temp : m_cmdutility->getControllerOptionsList())
+    {
+        if (temp.hasProfile())
+        {
+            if (temp.hasControllerNumber())
+                loadConfigFile(temp.getProfileLocation(), temp.getControllerNumber());
+            else if (temp.hasControllerID())
+                loadConfigFile(temp.getProfileLocation(), temp.getControllerID());
+            else
+                loadConfigFile(temp.getProfileLocation());
+        } else if (temp.isUnloadRequested())
+        {
+            if (temp.hasControllerNumber())
+                unloadCurrentConfig(temp.getControllerNumber());
+            else if (temp.hasControllerID())
+                unloadCurrentConfig(temp.getControllerID());
+            else
+                unloadCurrentConfig(0);
+        }
+
+        if (temp.getStartSetNumber() > 0)
+        {
+            if (temp.hasControllerNumber())
+                changeStartSetNumber(temp.getJoyStartSetNumber(), temp.getControllerNumber());
+            else if (temp.hasControllerID())
+                changeStartSetNumber(temp.getJoyStartSetNumber(), temp.getControllerID());
+            else
+                changeStartSetNumber(temp.getJoyStartSetNumber());
+        }
+    }
+}
+
+void HeadlessProfileManager::loadAppConfig(bool forceRefresh)
+{
+    for (DeviceProfiles *profiles : m_devices)
+        loadDeviceSettings(profiles, forceRefresh);
+}
+
+void HeadlessProfileManager::saveAppConfig()
+{
+    if (m_devices.isEmpty())
+        return;
+
+    INFO() << "Started saving app config";
+    QStringList tempIdentifierHolder;
+
+    for (DeviceProfiles *profiles : m_devices)
+    {
+        // Do not allow multi-controller adapters to overwrite each
+        // others recent config file list.
+        QString identifier = profiles->device->getStringIdentifier();
+        if (!identifier.isEmpty())
+        {
+            if (tempIdentifierHolder.contains(identifier))
+                continue;
+
+            tempIdentifierHolder.append(identifier);
+        }
+
+        saveDeviceSettings(profiles);
+    }
+
+    DEBUG() << "App config saved";
+}
+
+/**
+ * @brief Reloads profile selections written by another instance.
+ */
+void HeadlessProfileManager::handleInstanceDisconnect()
+{
+    m_settings->sync();
+    loadAppConfig(true);
+}
+
+void HeadlessProfileManager::loadConfigFile(QString fileLocation, int joystickIndex)
+{
+    if (joystickIndex > 0)
+    {
+        DeviceProfiles *profiles = findDevice(joystickIndex);
+        if (profiles != nullptr)
+            loadProfile(profiles, fileLocation);
+    } else
+    {
+        for (DeviceProfiles *profiles : m_devices)
+            loadProfile(profiles, fileLocation);
+    }
+}
+
+void HeadlessProfileManager::loadConfigFile(QString fileLocation, QString controllerID)
+{
+    if (controllerID.isEmpty())
+        return;
+
+    for (DeviceProfiles *profiles : m_devices)
+    {
+        if (controllerID == profiles->device->getStringIdentifier())
+            loadProfile(profiles, fileLocation);
+    }
+}
+
+void HeadlessProfileManager::unloadCurrentConfig(int joystickIndex)
+{
+    if (joystickIndex > 0)
+    {
+        DeviceProfiles *profiles = findDevice(joystickIndex);
+        if (profiles != nullptr)
+            selectProfile(profiles, QString());
+    } else
+    {
+        for (DeviceProfiles *profiles : m_devices)
+            selectProfile(profiles, QString());
+    }
+}
+
+void HeadlessProfileManager::unloadCurrentConfig(QString controllerID)
+{
+    if (controllerID.isEmpty())
+        return;
+
+    for (DeviceProfiles *profiles : m_devices)
+    {
+        if (controllerID == profiles->device->getStringIdentifier())
+            selectProfile(profiles, QString());
+    }
+}
+
+void HeadlessProfileManager::changeStartSetNumber(int startSetNumber, int joystickIndex)
+{
+    if (!m_apply_profiles)
+        return;
+
+    for (DeviceProfiles *profiles : m_devices)
+    {
+        if ((joystickIndex <= 0) || (profiles->device->getJoyNumber() == (joystickIndex - 1)))
+            QMetaObject::invokeMethod(profiles->device, "setActiveSetNumber", Q_ARG(int, startSetNumber));
+    }
+}
+
+void HeadlessProfileManager::changeStartSetNumber(int startSetNumber, QString controllerID)
+{
+    if (!m_apply_profiles || controllerID.isEmpty())
+        return;
+
+    for (DeviceProfiles *profiles : m_devices)
+    {
+        if (controllerID == profiles->device->getStringIdentifier())
+            QMetaObject::invokeMethod(profiles->device, "setActiveSetNumber", Q_ARG(int, startSetNumber));
+    }
+}
+
+/**
+ * @brief Finds a device by its one based index as used on the command line.
+ */
+HeadlessProfileManager::DeviceProfiles *HeadlessProfileManager::findDevice(int joystickIndex)
+{
+    for (DeviceProfiles *profiles : m_devices)
+    {
+        if (profiles->device->getJoyNumber() == (joystickIndex - 1))
+            return profiles;
+    }
+
+    return nullptr;
+}
+
+void HeadlessProfileManager::clearDevices()
+{
+    for (DeviceProfiles *profiles : m_devices)
+    {
+        profiles->helper->deleteLater();
+        delete profiles;
+    }
+
+    m_devices.clear();
+}
+
+/**
+ * @brief Reads the recent profile list of a device from the settings and
+ *  applies its last selected profile, like JoyTabWidget::loadSettings.
+ * @param[in] forceRefresh Reload the selected profile even if it did not change.
+ */
+void HeadlessProfileManager::loadDeviceSettings(DeviceProfiles *profiles, bool forceRefresh)
+{
+    INFO() << "Loading device settings for: " << profiles->device->getSDLName();
+
+    QString identifier = profiles->device->getStringIdentifier();
+    QString controlEntryString = QString("Controller%1ConfigFile%2").arg(identifier);
+    QString controlEntryLastSelected = QString("Controller%1LastSelected").arg(identifier);
+    QString controlEntryProfileName = QString("Controller%1ProfileName%2").arg(identifier);
+    QString lastfile = QString();
+
+    m_settings->getLock()->lock();
+
+    int numberRecentProfiles =
+        m_settings->value("NumberRecentProfiles", GlobalVariables::AntimicroSettings::defaultNumberRecentProfiles).toInt();
+    bool autoOpenLastProfile = m_settings->value("AutoOpenLastProfile", true).toBool();
+
+    m_settings->beginGroup("Controllers");
+    profiles->recent.clear();
+
+    if (!identifier.isEmpty())
+    {
+        for (int configFileNum = 1; (numberRecentProfiles <= 0) || (configFileNum <= numberRecentProfiles);
+             configFileNum++)
+        {
+            QString tempfilepath = m_settings->value(controlEntryString.arg(configFileNum), "").toString();
+            if (tempfilepath.isEmpty())
+                break;
+
+            QFileInfo fileInfo(tempfilepath);
+            bool known = false;
+            for (const ProfileEntry &entry : profiles->recent)
+                known = known || (entry.location == fileInfo.absoluteFilePath());
+
+            if (fileInfo.exists() && !known)
+            {
+                ProfileEntry entry;
+                entry.location = fileInfo.absoluteFilePath();
+                entry.name = m_settings->value(controlEntryProfileName.arg(configFileNum), "").toString();
+                profiles->recent.append(entry);
+            }
+        }
+
+        if (autoOpenLastProfile)
+            lastfile = m_settings->value(controlEntryLastSelected, "").toString();
+    }
+
+    m_settings->endGroup();
+    m_settings->getLock()->unlock();
+
+    QString selected = QString();
+    if (!lastfile.isEmpty())
+    {
+        QString lastFileAbsolute = QFileInfo(lastfile).absoluteFilePath();
+        for (const ProfileEntry &entry : profiles->recent)
+        {
+            if (entry.location == lastFileAbsolute)
+                selected = lastFileAbsolute;
+        }
+    }
+
+    selectProfile(profiles, selected, forceRefresh);
+}
+
+/**
+ * @brief Writes the recent profile list of a device to the settings with
+ *  the active profile first, like JoyTabWidget::saveSettings.
+ */
+void HeadlessProfileManager::saveDeviceSettings(DeviceProfiles *profiles)
+{
+    QString identifier = profiles->device->getStringIdentifier();
+    if (identifier.isEmpty())
+        return;
+
+    INFO() << "Saving config settings for controller: " << profiles->device->getSDLName();
+
+    QString controlEntryPrefix = QString("Controller%1").arg(identifier);
+    QString controlEntryString = QString("Controller%1ConfigFile%2").arg(identifier);
+    QString controlEntryLastSelected = QString("Controller%1LastSelected").arg(identifier);
+    QString controlEntryProfileName = QString("Controller%1ProfileName%2").arg(identifier);
+
+    QList<ProfileEntry> ordered;
+    for (const ProfileEntry &entry : profiles->recent)
+    {
+        if (entry.location == profiles->active)
+            ordered.prepend(entry);
+        else
+            ordered.append(entry);
+    }
+
+    m_settings->getLock()->lock();
+    m_settings->beginGroup("Controllers");
+
+    // Remove current settings for a controller
+    for (const QString &tempstring : m_settings->allKeys())
+    {
+        if (tempstring.startsWith(controlEntryPrefix))
+            m_settings->remove(tempstring);
+    }
+
+    for (int i = 0; i < ordered.size(); i++)
+    {
+        const ProfileEntry &entry = ordered.at(i);
+        QFileInfo profileBaseFile(entry.location);
+
+        m_settings->setValue(controlEntryString.arg(i + 1), settingsLocation(entry.location));
+
+        if (!entry.name.isEmpty() && (PadderCommon::getProfileName(profileBaseFile) != entry.name))
+            m_settings->setValue(controlEntryProfileName.arg(i + 1), entry.name);
+    }
+
+    m_settings->setValue(controlEntryLastSelected, settingsLocation(profiles->active));
+
+    m_settings->endGroup();
+    m_settings->getLock()->unlock();
+}
+
+/**
+ * @brief Adds a profile file to the front of the recent list of a device
+ *  and activates it, like JoyTabWidget::loadConfigFile.
+ */
+void HeadlessProfileManager::loadProfile(DeviceProfiles *profiles, QString fileLocation)
+{
+    QFileInfo fileinfo(fileLocation);
+    if (!fileinfo.exists() || ((fileinfo.suffix() != "xml") && (fileinfo.suffix() != "amgp")))
+        return;
+
+    int numberRecentProfiles =
+        m_settings->value("NumberRecentProfiles", GlobalVariables::AntimicroSettings::defaultNumberRecentProfiles).toInt();
+    QString location = fileinfo.absoluteFilePath();
+    bool known = false;
+    for (const ProfileEntry &entry : profiles->recent)
+        known = known || (entry.location == location);
+
+    if (!known)
+    {
+        if ((numberRecentProfiles > 0) && (profiles->recent.size() >= numberRecentProfiles))
+            profiles->recent.removeLast();
+
+        ProfileEntry entry;
+        entry.location = location;
+        profiles->recent.prepend(entry);
+    }
+
+    selectProfile(profiles, location);
+}
+
+/**
+ * @brief Configures a device with the given profile, or resets it if the
+ *  location is empty.
+ */
+void HeadlessProfileManager::selectProfile(DeviceProfiles *profiles, QString fileLocation, bool forceRefresh)
+{
+    if (!forceRefresh && (fileLocation == profiles->active))
+        return;
+
+    profiles->active = fileLocation;
+
+    if (!m_apply_profiles)
+        return;
+
+    JoyTabWidgetHelper *helper = profiles->helper;
+
+    if (fileLocation.isEmpty())
+    {
+        INFO() << "Unload profile of joystick " << profiles->device->getSDLName();
+        QMetaObject::invokeMethod(helper, "reInitDevice", blockingConnection(helper));
+    } else
+    {
+        INFO() << "Change joystick " << profiles->device->getSDLName() << " profile to: " << fileLocation;
+
+        bool result = false;
+        QMetaObject::invokeMethod(helper, "readConfigFile", blockingConnection(helper), Q_RETURN_ARG(bool, result),
+                                  Q_ARG(QString, fileLocation));
+
+        if (!result && helper->hasReader())
+            PRINT_STDERR() << helper->getReader()->getErrorString() << "\n";
+    }
+}
@@ -0,0 +1,95 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QList>
+#include <QMap>
+#include <QObject>
+#include <QString>
+
+#include <SDL2/SDL_joystick.h>
+
+class AntiMicroSettings;
+class CommandLineUtility;
+class InputDevice;
+class JoyTabWidgetHelper;
+
+/**
+ * @brief Manages controller profiles without any widgets when running headless.
+ *
+ * Takes over the profile handling of MainWindow and JoyTabWidget. The recent
+ * profile list and the last selected profile of each controller use the same
+ * settings keys as the GUI, so another instance can switch profiles of a
+ * headless instance through the local socket in the same way.
+ */
+class HeadlessProfileManager : public QObject
+{
+    Q_OBJECT
+
+  public:
+    explicit HeadlessProfileManager(QMap<SDL_JoystickID, InputDevice *> *joysticks, CommandLineUtility *cmdutility,
+                                    AntiMicroSettings *settings, bool applyProfiles = true, QObject *parent = nullptr);
+    ~HeadlessProfileManager();
+
+    void loadConfigFile(QString fileLocation, int joystickIndex = 0);
+    void loadConfigFile(QString fileLocation, QString controllerID);
+    void unloadCurrentConfig(int joystickIndex = 0);
+    void unloadCurrentConfig(QString controllerID);
+    void changeStartSetNumber(int startSetNumber, int joystickIndex = 0);
+    void changeStartSetNumber(int startSetNumber, QString controllerID);
+
+  public slots:
+    void fillDevices();
+    void fillDevicesMap(QMap<SDL_JoystickID, InputDevice *> *joysticks);
+    void addDevice(InputDevice *device);
+    void removeDevice(SDL_JoystickID deviceID);
+    void alterConfigFromSettings();
+    void loadAppConfig(bool forceRefresh = false);
+    void saveAppConfig();
+    void handleInstanceDisconnect();
+
+  private:
+    struct ProfileEntry
+    {
+        QString location;
+        // Custom name, empty if the file name is used.
+        QString name;
+    };
+
+    struct DeviceProfiles
+    {
+        InputDevice *device;
+        JoyTabWidgetHelper *helper;
+        QList<ProfileEntry> recent;
+        // Location of the active profile, empty for none.
+        QString active;
+    };
+
+    DeviceProfiles *findDevice(int joystickIndex);
+    void clearDevices();
+    void loadDeviceSettings(DeviceProfiles *profiles, bool forceRefresh = false);
+    void saveDeviceSettings(DeviceProfiles *profiles);
+    void loadProfile(DeviceProfiles *profiles, QString fileLocation);
+    void selectProfile(DeviceProfiles *profiles, QString fileLocation, bool forceRefresh = false);
+
+    QMap<SDL_JoystickID, InputDevice *> *m_joysticks;
+    CommandLineUtility *m_cmdutility;
+    AntiMicroSettings *m_settings;
+    bool m_apply_profiles;
+    // Ordered by joystick number like the tabs of MainWindow.
+    QList<DeviceProfiles *> m_devices;
+};
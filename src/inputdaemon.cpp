@@ -20,8 +20,11 @@
 
 #include "antimicrosettings.h"
 #include "common.h"
+#include "event.h"
 #include "globalvariables.h"
 #include "inputdevicebitarraystatus.h"
+#include "inputeventbatch.h"
+#include "joycontrolstick.h"
 #include "joydpad.h"
 #include "joysensor.h"
 #include "joystick.h"
@@ -34,12 +37,43 @@
 #include <QThread>
 #include <QTime>
 #include <QTimer>
+#include <QVector>
 
 #define USE_NEW_REFRESH
 
+namespace {
+/**
+ * @brief Classifies an axis value by the side of the dead zone it is on.
+ *  Axes of a control stick use the dead zone of the stick.
+ * @return 0 inside of the dead zone, 1 or -1 beyond it
+ */
+int axisZone(JoyAxis *axis, int value)
+{
+    if (axis->isCalibrated())
+    {
+        double offset = 0.0;
+        double gain = 1.0;
+        axis->getCalibration(&offset, &gain);
+        value = value * gain + offset;
+    }
+
+    JoyControlStick *stick = axis->getControlStick();
+    int deadZone = (stick != nullptr) ? stick->getDeadZone() : axis->getDeadZone();
+    int throttled = axis->calculateThrottledValue(value);
+
+    if (abs(throttled) <= deadZone)
+        return 0;
+
+    return (throttled > 0) ? 1 : -1;
+}
+} // namespace
+
 InputDaemon::InputDaemon(QMap<SDL_JoystickID, InputDevice *> *joysticks, AntiMicroSettings *settings, bool graphical,
                          QObject *parent)
     : QObject(parent)
+    , m_device_tables_dirty(true)
+    , m_max_event_batch_size(0)
+    , m_coalesced_events(0)
     , pollResetTimer(this)
 {
     m_joysticks = joysticks;
@@ -49,6 +83,16 @@ InputDaemon::InputDaemon(QMap<SDL_JoystickID, InputDevice *> *joysticks, AntiMic
     m_graphical = graphical;
     m_settings = settings;
 
+    m_settings->getLock()->lock();
+    m_activate_per_batch =
+        m_settings->value("ActivateEventsPerBatch", GlobalVariables::AntimicroSettings::defaultActivateEventsPerBatch)
+            .toBool();
+    m_coalesce_events =
+        m_settings->value("CoalesceInputEvents", GlobalVariables::AntimicroSettings::defaultCoalesceInputEvents).toBool();
+    m_average_gyro_samples =
+        m_settings->value("AverageGyroSamples", GlobalVariables::AntimicroSettings::defaultAverageGyroSamples).toBool();
+    m_settings->getLock()->unlock();
+
     eventWorker = new SDLEventReader(joysticks, settings);
     refreshJoysticks();
     sdlWorkerThread = nullptr;
@@ -64,6 +108,8 @@ InputDaemon::InputDaemon(QMap<SDL_JoystickID, InputDevice *> *joysticks, AntiMic
 
         connect(JoyButton::getMouseHelper(), &JoyButtonMouseHelper::gamepadRefreshRateUpdated, eventWorker,
                 &SDLEventReader::updatePollRate);
+        connect(JoyButton::getMouseHelper(), &JoyButtonMouseHelper::gamepadEventDrivenUpdated, eventWorker,
+                &SDLEventReader::setEventDriven);
 
         connect(JoyButton::getMouseHelper(), &JoyButtonMouseHelper::gamepadRefreshRateUpdated, this,
                 &InputDaemon::updatePollResetRate);
@@ -114,6 +160,10 @@ void InputDaemon::run()
         QQueue<SDL_Event> sdlEventQueue;
         firstInputPass(&sdlEventQueue);
         modifyUnplugEvents(&sdlEventQueue);
+
+        if (m_activate_per_batch && m_coalesce_events)
+            coalesceEvents(&sdlEventQueue);
+
         secondInputPass(&sdlEventQueue);
         clearBitArrayStatusInstances();
     }
@@ -170,6 +220,7 @@ void InputDaemon::refreshJoysticks()
     m_joysticks->clear();
     getTrackjoysticksLocal().clear();
     trackcontrollers.clear();
+    m_device_tables_dirty = true;
 
     m_settings->getLock()->lock();
     m_settings->beginGroup("Mappings");
@@ -230,6 +281,7 @@ void InputDaemon::refreshJoysticks()
                         connect(damncontroller, &GameController::requestWait, eventWorker, &SDLEventReader::haltServices);
                         m_joysticks->insert(tempJoystickID, damncontroller);
                         trackcontrollers.insert(tempJoystickID, damncontroller);
+                        m_device_tables_dirty = true;
 
                         emit deviceAdded(damncontroller);
                     } else
@@ -273,6 +325,7 @@ void InputDaemon::refreshJoysticks()
                 SDL_JoystickID joystickID = SDL_JoystickInstanceID(sdlStick);
                 m_joysticks->insert(joystickID, damncontroller);
                 trackcontrollers.insert(joystickID, damncontroller);
+                m_device_tables_dirty = true;
             } else
             {
                 Joystick *curJoystick = new Joystick(joystick, i, m_settings, this);
@@ -280,6 +333,7 @@ void InputDaemon::refreshJoysticks()
                 SDL_JoystickID joystickID = SDL_JoystickInstanceID(joystick);
                 m_joysticks->insert(joystickID, curJoystick);
                 trackjoysticks.insert(joystickID, curJoystick);
+                m_device_tables_dirty = true;
             }
         }
 #endif
@@ -299,7 +353,7 @@ void InputDaemon::stop()
 
 void InputDaemon::refresh()
 {
-    qDebug() << "REFRESH";
+    TRACE() << "REFRESH";
 
     stop();
 
@@ -396,6 +450,7 @@ void InputDaemon::refreshMapping(QString mapping, InputDevice *device)
                 {
                     device->closeSDLDevice();
                     getTrackjoysticksLocal().remove(joystickID);
+                    m_device_tables_dirty = true;
                     m_joysticks->remove(joystickID);
 
                     SDL_GameController *controller = SDL_GameControllerOpen(i);
@@ -425,6 +480,7 @@ void InputDaemon::refreshMapping(QString mapping, InputDevice *device)
                     joystickID = SDL_JoystickInstanceID(sdlStick);
                     m_joysticks->insert(joystickID, damncontroller);
                     trackcontrollers.insert(joystickID, damncontroller);
+                    m_device_tables_dirty = true;
                     emit deviceUpdated(i, damncontroller);
                 }
             }
@@ -444,6 +500,7 @@ void InputDaemon::removeDevice(InputDevice *device)
         m_joysticks->remove(deviceID);
         getTrackjoysticksLocal().remove(deviceID);
         trackcontrollers.remove(deviceID);
+        m_device_tables_dirty = true;
 
         refreshIndexes();
 
@@ -503,6 +560,7 @@ void InputDaemon::addInputDevice(int index, QMap<QString, int> &uniques, int &co
                     connect(damncontroller, &GameController::requestWait, eventWorker, &SDLEventReader::haltServices);
                     m_joysticks->insert(tempJoystickID, damncontroller);
                     trackcontrollers.insert(tempJoystickID, damncontroller);
+                    m_device_tables_dirty = true;
 
                     qInfo() << QString("New game controller found - #%1 [%2]".arg(index + 1).arg(
                         QTime::currentTime().toString("hh:mm:ss.zzz")));
@@ -629,6 +687,7 @@ void InputDaemon::addInputDevice(int index, QMap<QString, int> &uniques, int &co
                         connect(damncontroller, &GameController::requestWait, eventWorker, &SDLEventReader::haltServices);
                         m_joysticks->insert(tempJoystickID_local_2, damncontroller);
                         trackcontrollers.insert(tempJoystickID_local_2, damncontroller);
+                        m_device_tables_dirty = true;
 
                         m_settings->endGroup();
                         m_settings->getLock()->unlock();
@@ -647,6 +706,7 @@ void InputDaemon::addInputDevice(int index, QMap<QString, int> &uniques, int &co
                 Joystick *curJoystick = new Joystick(joystick, index, m_settings, this);
                 m_joysticks->insert(tempJoystickID_local, curJoystick);
                 getTrackjoysticksLocal().insert(tempJoystickID_local, curJoystick);
+                m_device_tables_dirty = true;
 
                 m_settings->endGroup();
                 m_settings->getLock()->unlock();
@@ -675,6 +735,7 @@ Joystick *InputDaemon::openJoystickDevice(int index)
         curJoystick = new Joystick(joystick, index, m_settings, this);
         m_joysticks->insert(tempJoystickID, curJoystick);
         getTrackjoysticksLocal().insert(tempJoystickID, curJoystick);
+        m_device_tables_dirty = true;
     }
 
     return curJoystick;
@@ -737,14 +798,14 @@ void InputDaemon::firstInputPass(QQueue<SDL_Event> *sdlEventQueue)
                 type = QString().number(event.type);
             DEBUG() << "Processing event: " << type << " From joystick with instance id: " << (int)event.jbutton.which
                     << " Got button with id: " << (int)event.jbutton.button << " is one of the GameControllers: "
-                    << (trackcontrollers.contains(event.jbutton.which) ? "true" : "false") << " is one of the joysticks:"
-                    << (getTrackjoysticksLocal().contains(event.jbutton.which) ? "true" : "false");
+                    << ((getTrackedController(event.jbutton.which) != nullptr) ? "true" : "false") << " is one of the joysticks:"
+                    << ((getTrackedJoystick(event.jbutton.which) != nullptr) ? "true" : "false");
         }
         switch (event.type)
         {
         case SDL_JOYBUTTONDOWN:
         case SDL_JOYBUTTONUP: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jbutton.which);
+            InputDevice *joy = getTrackedJoystick(event.jbutton.which);
 
             if (joy != nullptr)
             {
@@ -765,7 +826,7 @@ void InputDaemon::firstInputPass(QQueue<SDL_Event> *sdlEventQueue)
             break;
         }
         case SDL_JOYAXISMOTION: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jaxis.which);
+            InputDevice *joy = getTrackedJoystick(event.jaxis.which);
 
             if (joy != nullptr)
             {
@@ -789,7 +850,7 @@ void InputDaemon::firstInputPass(QQueue<SDL_Event> *sdlEventQueue)
             break;
         }
         case SDL_JOYHATMOTION: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jhat.which);
+            InputDevice *joy = getTrackedJoystick(event.jhat.which);
 
             if (joy != nullptr)
             {
@@ -811,7 +872,7 @@ void InputDaemon::firstInputPass(QQueue<SDL_Event> *sdlEventQueue)
         }
 
         case SDL_CONTROLLERAXISMOTION: {
-            InputDevice *joy = trackcontrollers.value(event.caxis.which);
+            InputDevice *joy = getTrackedController(event.caxis.which);
 
             if (joy != nullptr)
             {
@@ -843,7 +904,7 @@ void InputDaemon::firstInputPass(QQueue<SDL_Event> *sdlEventQueue)
 
 #if SDL_VERSION_ATLEAST(2, 0, 14)
         case SDL_CONTROLLERSENSORUPDATE: {
-            InputDevice *joy = trackcontrollers.value(event.caxis.which);
+            InputDevice *joy = getTrackedController(event.caxis.which);
 
             if (joy != nullptr)
             {
@@ -874,7 +935,7 @@ void InputDaemon::firstInputPass(QQueue<SDL_Event> *sdlEventQueue)
 
         case SDL_CONTROLLERBUTTONDOWN:
         case SDL_CONTROLLERBUTTONUP: {
-            InputDevice *joy = trackcontrollers.value(event.cbutton.which);
+            InputDevice *joy = getTrackedController(event.cbutton.which);
 
             if (joy != nullptr)
             {
@@ -925,7 +986,7 @@ void InputDaemon::modifyUnplugEvents(QQueue<SDL_Event> *sdlEventQueue)
 
         int bitArraySize = tempBitArray.size();
 
-        qDebug() << "Raw array: " << tempBitArray << " array size: " << bitArraySize;
+        TRACE() << "Raw array: " << tempBitArray << " array size: " << bitArraySize;
 
         if ((bitArraySize > 0) && (tempBitArray.count(true) == device->getNumberAxes()))
         {
@@ -957,7 +1018,7 @@ void InputDaemon::modifyUnplugEvents(QQueue<SDL_Event> *sdlEventQueue)
                                 tempQueue.enqueue(event);
                             } else
                             {
-                                InputDevice *joy = getTrackjoysticksLocal().value(event.jaxis.which);
+                                InputDevice *joy = getTrackedJoystick(event.jaxis.which);
 
                                 if (joy != nullptr)
                                 {
@@ -986,7 +1047,7 @@ void InputDaemon::modifyUnplugEvents(QQueue<SDL_Event> *sdlEventQueue)
                                 tempQueue.enqueue(event);
                             } else
                             {
-                                InputDevice *joy = trackcontrollers.value(event.caxis.which);
+                                InputDevice *joy = getTrackedController(event.caxis.which);
 
                                 if (joy != nullptr)
                                 {
@@ -1055,9 +1116,143 @@ QBitArray InputDaemon::createUnplugEventBitArray(InputDevice *device)
     return unplugBitArray;
 }
 
+/**
+ * @brief Drops axis and sensor events which are superseded by a newer
+ *  event for the same element later in the batch.
+ *
+ *  Only the latest event of an axis is kept at its original position so the
+ *  expensive axis and stick logic runs once per batch. An event is never
+ *  dropped for a newer one on the other side of the dead zone. The kept
+ *  events reach the axis one by one, because InputEventBatch activates the
+ *  batch before an axis is queued again, so short presses of an axis inside
+ *  one batch still reach the axis buttons. Raw axis signals used by the
+ *  mapping dialog are emitted for dropped joystick axis events, and joystick
+ *  axis events of game controllers, which only feed these signals, are not
+ *  coalesced at all. Gyroscope samples are averaged over the batch when
+ *  m_average_gyro_samples is set instead of keeping only the last sample.
+ *  Button, hat and device events act as barriers because their activation
+ *  can change the active set.
+ */
+void InputDaemon::coalesceEvents(QQueue<SDL_Event> *sdlEventQueue)
+{
+    struct CoalesceEntry
+    {
+        int index;
+        int zone;
+        int samples;
+        float sum[3];
+    };
+
+    QHash<quint64, CoalesceEntry> latestEvents;
+    QVector<bool> dropped(sdlEventQueue->size(), false);
+    int droppedCount = 0;
+
+    for (int i = 0; i < sdlEventQueue->size(); i++)
+    {
+        SDL_Event &event = (*sdlEventQueue)[i];
+        quint64 key = 0;
+        int zone = 0;
+        bool accumulate = false;
+
+        switch (event.type)
+        {
+        case SDL_JOYAXISMOTION: {
+            InputDevice *joy = getTrackedJoystick(event.jaxis.which);
+            JoyAxis *axis = (joy != nullptr) ? joy->getActiveSetJoystick()->getJoyAxis(event.jaxis.axis) : nullptr;
+
+            if (axis != nullptr)
+            {
+                key = (static_cast<quint64>(static_cast<Uint32>(event.jaxis.which)) << 32) | (1 << 16) | event.jaxis.axis;
+                zone = axisZone(axis, event.jaxis.value);
+            }
+            break;
+        }
+        case SDL_CONTROLLERAXISMOTION: {
+            InputDevice *joy = getTrackedController(event.caxis.which);
+            JoyAxis *axis = (joy != nullptr) ? joy->getActiveSetJoystick()->getJoyAxis(event.caxis.axis) : nullptr;
+
+            if (axis != nullptr)
+            {
+                key = (static_cast<quint64>(static_cast<Uint32>(event.caxis.which)) << 32) | (2 << 16) | event.caxis.axis;
+                zone = axisZone(axis, event.caxis.value);
+            }
+            break;
+        }
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+        case SDL_CONTROLLERSENSORUPDATE: {
+            key = (static_cast<quint64>(static_cast<Uint32>(event.csensor.which)) << 32) | (3 << 16) |
+                  static_cast<Uint16>(event.csensor.sensor);
+            accumulate = m_average_gyro_samples && (event.csensor.sensor == SDL_SENSOR_GYRO);
+            break;
+        }
+#endif
+        default: {
+            latestEvents.clear();
+            break;
+        }
+        }
+
+        if (key == 0)
+            continue;
+
+        auto iter = latestEvents.find(key);
+        if ((iter == latestEvents.end()) || (iter->zone != zone))
+        {
+            CoalesceEntry entry = {i, zone, 0, {0.0f, 0.0f, 0.0f}};
+            iter = latestEvents.insert(key, entry);
+        } else
+        {
+            // Raw axis values are passed on for every event.
+            if (event.type == SDL_JOYAXISMOTION)
+            {
+                const SDL_JoyAxisEvent &rawEvent = sdlEventQueue->at(iter->index).jaxis;
+                getTrackedJoystick(rawEvent.which)->rawAxisEvent(rawEvent.which, rawEvent.value);
+            }
+
+            dropped[iter->index] = true;
+            droppedCount++;
+            iter->index = i;
+        }
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+        if (accumulate)
+        {
+            iter->samples++;
+            for (int j = 0; j < 3; j++)
+            {
+                iter->sum[j] += event.csensor.data[j];
+                event.csensor.data[j] = iter->sum[j] / iter->samples;
+            }
+        }
+#else
+        Q_UNUSED(accumulate);
+#endif
+    }
+
+    if (droppedCount > 0)
+    {
+        QQueue<SDL_Event> tempQueue;
+        tempQueue.reserve(sdlEventQueue->size() - droppedCount);
+
+        for (int i = 0; i < sdlEventQueue->size(); i++)
+        {
+            if (!dropped.at(i))
+                tempQueue.enqueue(sdlEventQueue->at(i));
+        }
+
+        sdlEventQueue->swap(tempQueue);
+        m_coalesced_events += droppedCount;
+    }
+}
+
 /**
  * @brief Dispatches postprocessed SDL events to the input objects like
- *  JoyAxis or JoyButton and activates them at the end.
+ *  JoyAxis or JoyButton and activates them.
+ *
+ *  In per-batch mode the queued element events are activated once after the
+ *  whole batch has been dispatched, see InputEventBatch for the cases which
+ *  activate them earlier. In per-event mode they are activated after every
+ *  single event.
  */
 void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
 {
@@ -1065,7 +1260,10 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
     int counterUniques = 1;
     bool duplicatedGamepad = false;
 
-    QHash<SDL_JoystickID, InputDevice *> activeDevices;
+    InputEventBatch batch;
+
+    updateEventBatchStatistics(sdlEventQueue->size());
+    beginOutputBatch();
 
     while (!sdlEventQueue->isEmpty())
     {
@@ -1075,23 +1273,20 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
         {
         case SDL_JOYBUTTONDOWN:
         case SDL_JOYBUTTONUP: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jbutton.which);
+            InputDevice *joy = getTrackedJoystick(event.jbutton.which);
 
             if (joy != nullptr)
             {
+                joy->getStateSnapshot().setButton(event.jbutton.button, event.type == SDL_JOYBUTTONDOWN);
+
                 SetJoystick *set = joy->getActiveSetJoystick();
                 JoyButton *button = set->getJoyButton(event.jbutton.button);
 
                 if (button != nullptr)
-                {
-                    button->queuePendingEvent(event.type == SDL_JOYBUTTONDOWN ? true : false);
-
-                    if (!activeDevices.contains(event.jbutton.which))
-                        activeDevices.insert(event.jbutton.which, joy);
-                }
-            } else if (trackcontrollers.contains(event.jbutton.which))
+                    batch.queueButtonEvent(joy, button, event.type == SDL_JOYBUTTONDOWN);
+            } else if ((getTrackedController(event.jbutton.which) != nullptr))
             {
-                GameController *gamepad = trackcontrollers.value(event.jbutton.which);
+                GameController *gamepad = getTrackedController(event.jbutton.which);
                 gamepad->rawButtonEvent(event.jbutton.button, event.type == SDL_JOYBUTTONDOWN ? true : false);
             }
 
@@ -1099,25 +1294,24 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
         }
 
         case SDL_JOYAXISMOTION: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jaxis.which);
+            InputDevice *joy = getTrackedJoystick(event.jaxis.which);
 
             if (joy != nullptr)
             {
+                int rawValue = qBound(GlobalVariables::JoyAxis::AXISMIN, static_cast<int>(event.jaxis.value),
+                                      GlobalVariables::JoyAxis::AXISMAX);
+                joy->getStateSnapshot().setAxis(event.jaxis.axis, rawValue);
+
                 SetJoystick *set = joy->getActiveSetJoystick();
                 JoyAxis *axis = set->getJoyAxis(event.jaxis.axis);
 
                 if (axis != nullptr)
-                {
-                    axis->queuePendingEvent(event.jaxis.value);
-
-                    if (!activeDevices.contains(event.jaxis.which))
-                        activeDevices.insert(event.jaxis.which, joy);
-                }
+                    batch.queueAxisEvent(joy, axis, event.jaxis.value);
 
                 joy->rawAxisEvent(event.jaxis.which, event.jaxis.value);
-            } else if (trackcontrollers.contains(event.jaxis.which))
+            } else if ((getTrackedController(event.jaxis.which) != nullptr))
             {
-                GameController *gamepad = trackcontrollers.value(event.jaxis.which);
+                GameController *gamepad = getTrackedController(event.jaxis.which);
                 gamepad->rawAxisEvent(event.jaxis.axis, event.jaxis.value);
             }
 
@@ -1125,23 +1319,23 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
         }
 
         case SDL_JOYHATMOTION: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jhat.which);
+            InputDevice *joy = getTrackedJoystick(event.jhat.which);
 
             if (joy != nullptr)
             {
+                joy->getStateSnapshot().setHat(event.jhat.hat, event.jhat.value);
+
                 SetJoystick *set = joy->getActiveSetJoystick();
                 JoyDPad *dpad = set->getJoyDPad(event.jhat.hat);
 
                 if (dpad != nullptr)
                 {
                     dpad->joyEvent(event.jhat.value);
-
-                    if (!activeDevices.contains(event.jhat.which))
-                        activeDevices.insert(event.jhat.which, joy);
+                    batch.addDevice(joy);
                 }
-            } else if (trackcontrollers.contains(event.jhat.which))
+            } else if ((getTrackedController(event.jhat.which) != nullptr))
             {
-                GameController *gamepad = trackcontrollers.value(event.jaxis.which);
+                GameController *gamepad = getTrackedController(event.jaxis.which);
                 gamepad->rawDPadEvent(event.jhat.hat, event.jhat.value);
             }
 
@@ -1149,20 +1343,19 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
         }
 
         case SDL_CONTROLLERAXISMOTION: {
-            InputDevice *joy = trackcontrollers.value(event.caxis.which);
+            InputDevice *joy = getTrackedController(event.caxis.which);
 
             if (joy != nullptr)
             {
+                int rawValue = qBound(GlobalVariables::JoyAxis::AXISMIN, static_cast<int>(event.caxis.value),
+                                      GlobalVariables::JoyAxis::AXISMAX);
+                joy->getStateSnapshot().setAxis(event.caxis.axis, rawValue);
+
                 SetJoystick *set = joy->getActiveSetJoystick();
                 JoyAxis *axis = set->getJoyAxis(event.caxis.axis);
 
                 if (axis != nullptr)
-                {
-                    axis->queuePendingEvent(event.caxis.value);
-
-                    if (!activeDevices.contains(event.caxis.which))
-                        activeDevices.insert(event.caxis.which, joy);
-                }
+                    batch.queueAxisEvent(joy, axis, event.caxis.value);
             }
 
             break;
@@ -1170,7 +1363,7 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
 
 #if SDL_VERSION_ATLEAST(2, 0, 14)
         case SDL_CONTROLLERSENSORUPDATE: {
-            InputDevice *joy = trackcontrollers.value(event.csensor.which);
+            InputDevice *joy = getTrackedController(event.csensor.which);
 
             if (joy != nullptr)
             {
@@ -1184,12 +1377,7 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
                     Q_ASSERT(false);
 
                 if (sensor != nullptr)
-                {
-                    sensor->queuePendingEvent(event.csensor.data);
-
-                    if (!activeDevices.contains(event.csensor.which))
-                        activeDevices.insert(event.csensor.which, joy);
-                }
+                    batch.queueSensorEvent(joy, sensor, event.csensor.data);
             }
 
             break;
@@ -1198,20 +1386,17 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
 
         case SDL_CONTROLLERBUTTONDOWN:
         case SDL_CONTROLLERBUTTONUP: {
-            InputDevice *joy = trackcontrollers.value(event.cbutton.which);
+            InputDevice *joy = getTrackedController(event.cbutton.which);
 
             if (joy != nullptr)
             {
+                joy->getStateSnapshot().setButton(event.cbutton.button, event.type == SDL_CONTROLLERBUTTONDOWN);
+
                 SetJoystick *set = joy->getActiveSetJoystick();
                 JoyButton *button = set->getJoyButton(event.cbutton.button);
 
                 if (button != nullptr)
-                {
-                    button->queuePendingEvent(event.type == SDL_CONTROLLERBUTTONDOWN ? true : false);
-
-                    if (!activeDevices.contains(event.cbutton.which))
-                        activeDevices.insert(event.cbutton.which, joy);
-                }
+                    batch.queueButtonEvent(joy, button, event.type == SDL_CONTROLLERBUTTONDOWN);
             }
 
             break;
@@ -1223,6 +1408,8 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
 
             if (device != nullptr)
             {
+                batch.activate();
+
                 qInfo() << QString("Removing joystick #%1 [%2]")
                                .arg(device->getRealJoyNumber())
                                .arg(QTime::currentTime().toString("hh:mm:ss.zzz"));
@@ -1248,27 +1435,57 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
             break;
         }
 
-        // Active possible queued events.
-        QHashIterator<SDL_JoystickID, InputDevice *> activeDevIter(activeDevices);
+        if (!m_activate_per_batch)
+            batch.activate();
+    }
 
-        while (activeDevIter.hasNext())
-        {
-            InputDevice *tempDevice = activeDevIter.next().value();
-            tempDevice->activatePossibleControlStickEvents();
-            tempDevice->activatePossibleAxisEvents();
-            tempDevice->activatePossibleSensorEvents();
-            tempDevice->activatePossibleDPadEvents();
-            tempDevice->activatePossibleVDPadEvents();
-            tempDevice->activatePossibleButtonEvents();
-        }
+    batch.activate();
+
+    flushOutputBatch();
+}
+
+/**
+ * @brief Records the amount of events dispatched in one run of
+ *  secondInputPass and periodically reports the statistics.
+ */
+void InputDaemon::updateEventBatchStatistics(int batchSize)
+{
+    if (batchSize <= 0)
+        return;
+
+    m_event_batch_stats.process(batchSize);
+    m_max_event_batch_size = qMax(m_max_event_batch_size, batchSize);
 
-        if (JoyButton::shouldInvokeMouseEvents(JoyButton::getPendingMouseButtons(), JoyButton::getStaticMouseEventTimer(),
-                                               JoyButton::getTestOldMouseTime()))
-            JoyButton::invokeMouseEvents(
-                JoyButton::getMouseHelper()); // Do not wait for next event loop run. Execute immediately.
+    if (Logger::isDebugEnabled() &&
+        ((m_event_batch_stats.getCount() % GlobalVariables::InputDaemon::EVENTBATCHREPORTINTERVAL) == 0))
+    {
+        DEBUG() << "Event batches: " << m_event_batch_stats.getCount()
+                << " Events per batch mean: " << m_event_batch_stats.getMean()
+                << " variance: " << m_event_batch_stats.calculateVariance() << " max: " << m_max_event_batch_size
+                << " Activation: " << (m_activate_per_batch ? "per batch" : "per event")
+                << " Coalesced events: " << m_coalesced_events;
     }
 }
 
+bool InputDaemon::isActivatingEventsPerBatch() const { return m_activate_per_batch; }
+
+bool InputDaemon::isCoalescingEvents() const { return m_coalesce_events; }
+
+bool InputDaemon::isAveragingGyroSamples() const { return m_average_gyro_samples; }
+
+quint64 InputDaemon::getCoalescedEventCount() const { return m_coalesced_events; }
+
+const StatisticsEstimator &InputDaemon::getEventBatchStatistics() const { return m_event_batch_stats; }
+
+int InputDaemon::getMaxEventBatchSize() const { return m_max_event_batch_size; }
+
+void InputDaemon::resetEventBatchStatistics()
+{
+    m_event_batch_stats.reset();
+    m_max_event_batch_size = 0;
+    m_coalesced_events = 0;
+}
+
 void InputDaemon::clearBitArrayStatusInstances()
 {
     QHashIterator<InputDevice *, InputDeviceBitArrayStatus *> genIter(releaseEventsGenerated);
@@ -1333,12 +1550,12 @@ void InputDaemon::convertMappingsToUnique(QSettings *sett, QString guidString, Q
     if (sett->contains(guidString))
     {
         QStringList gg = sett->value(guidString).toString().split(",");
-        qDebug() << "Convert guidString to uniqueString 1): " << gg;
+        TRACE() << "Convert guidString to uniqueString 1): " << gg;
         gg.removeFirst();
-        qDebug() << "Convert guidString to uniqueString 2): " << gg;
+        TRACE() << "Convert guidString to uniqueString 2): " << gg;
         gg.prepend(uniqueIdString);
-        qDebug() << "Convert guidString to uniqueString 3): " << gg;
-        qDebug() << "Joined uniqueMapping: " << gg.join(",");
+        TRACE() << "Convert guidString to uniqueString 3): " << gg;
+        TRACE() << "Joined uniqueMapping: " << gg.join(",");
         sett->setValue(uniqueIdString, gg.join(","));
         sett->remove(guidString);
     }
@@ -1346,6 +1563,55 @@ void InputDaemon::convertMappingsToUnique(QSettings *sett, QString guidString, Q
 
 QHash<SDL_JoystickID, Joystick *> &InputDaemon::getTrackjoysticksLocal() { return trackjoysticks; }
 
+/**
+ * @brief Rebuild the dense SDL instance id tables from trackjoysticks and
+ *  trackcontrollers. SDL hands out small increasing instance ids so the
+ *  tables stay small.
+ */
+void InputDaemon::rebuildDeviceTables()
+{
+    int size = 0;
+
+    for (auto iter = trackjoysticks.cbegin(); iter != trackjoysticks.cend(); ++iter)
+        size = qMax(size, static_cast<int>(iter.key()) + 1);
+
+    for (auto iter = trackcontrollers.cbegin(); iter != trackcontrollers.cend(); ++iter)
+        size = qMax(size, static_cast<int>(iter.key()) + 1);
+
+    m_joystick_table.fill(nullptr, size);
+    m_controller_table.fill(nullptr, size);
+
+    for (auto iter = trackjoysticks.cbegin(); iter != trackjoysticks.cend(); ++iter)
+    {
+        if (iter.key() >= 0)
+            m_joystick_table[iter.key()] = iter.value();
+    }
+
+    for (auto iter = trackcontrollers.cbegin(); iter != trackcontrollers.cend(); ++iter)
+    {
+        if (iter.key() >= 0)
+            m_controller_table[iter.key()] = iter.value();
+    }
+
+    m_device_tables_dirty = false;
+}
+
+Joystick *InputDaemon::getTrackedJoystick(SDL_JoystickID which)
+{
+    if (m_device_tables_dirty)
+        rebuildDeviceTables();
+
+    return ((which >= 0) && (which < m_joystick_table.size())) ? m_joystick_table.at(which) : nullptr;
+}
+
+GameController *InputDaemon::getTrackedController(SDL_JoystickID which)
+{
+    if (m_device_tables_dirty)
+        rebuildDeviceTables();
+
+    return ((which >= 0) && (which < m_controller_table.size())) ? m_controller_table.at(which) : nullptr;
+}
+
 QHash<InputDevice *, InputDeviceBitArrayStatus *> &InputDaemon::getReleaseEventsGeneratedLocal()
 {
     return releaseEventsGenerated;
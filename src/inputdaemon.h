@@ -20,6 +20,7 @@
 #define INPUTDAEMONTHREAD_H
 
 #include "gamecontroller/gamecontroller.h"
+#include "statisticsestimator.h"
 //#include "fakeclasses/xbox360wireless.h"
 #include <SDL2/SDL_events.h>
 
@@ -45,6 +46,15 @@ class InputDaemon : public QObject
                          QObject *parent = 0);
     ~InputDaemon();
 
+    bool isActivatingEventsPerBatch() const;
+    bool isCoalescingEvents() const;
+    bool isAveragingGyroSamples() const;
+
+    const StatisticsEstimator &getEventBatchStatistics() const;
+    quint64 getCoalescedEventCount() const;
+    int getMaxEventBatchSize() const;
+    void resetEventBatchStatistics();
+
   protected:
     InputDeviceBitArrayStatus *createOrGrabBitStatusEntry(QHash<InputDevice *, InputDeviceBitArrayStatus *> *statusHash,
                                                           InputDevice *device, bool readCurrent = true);
@@ -54,7 +64,9 @@ class InputDaemon : public QObject
 
     void firstInputPass(QQueue<SDL_Event> *sdlEventQueue);
     void secondInputPass(QQueue<SDL_Event> *sdlEventQueue);
+    void updateEventBatchStatistics(int batchSize);
     void modifyUnplugEvents(QQueue<SDL_Event> *sdlEventQueue);
+    void coalesceEvents(QQueue<SDL_Event> *sdlEventQueue);
     QBitArray createUnplugEventBitArray(InputDevice *device);
     Joystick *openJoystickDevice(int index);
 
@@ -90,6 +102,9 @@ class InputDaemon : public QObject
 
   private:
     QHash<SDL_JoystickID, Joystick *> &getTrackjoysticksLocal();
+    Joystick *getTrackedJoystick(SDL_JoystickID which);
+    GameController *getTrackedController(SDL_JoystickID which);
+    void rebuildDeviceTables();
     QHash<InputDevice *, InputDeviceBitArrayStatus *> &getReleaseEventsGeneratedLocal();
     QHash<InputDevice *, InputDeviceBitArrayStatus *> &getPendingEventValuesLocal();
 
@@ -97,11 +112,24 @@ class InputDaemon : public QObject
     QHash<SDL_JoystickID, Joystick *> trackjoysticks;
     QHash<SDL_JoystickID, GameController *> trackcontrollers;
 
+    // Dense SDL instance id -> device tables mirroring trackjoysticks and
+    // trackcontrollers for the per-event dispatch.
+    bool m_device_tables_dirty;
+    QVector<Joystick *> m_joystick_table;
+    QVector<GameController *> m_controller_table;
+
     QHash<InputDevice *, InputDeviceBitArrayStatus *> releaseEventsGenerated;
     QHash<InputDevice *, InputDeviceBitArrayStatus *> pendingEventValues;
 
     bool stopped;
     bool m_graphical;
+    bool m_activate_per_batch;
+    bool m_coalesce_events;
+    bool m_average_gyro_samples;
+
+    StatisticsEstimator m_event_batch_stats;
+    int m_max_event_batch_size;
+    quint64 m_coalesced_events;
 
     SDLEventReader *eventWorker;
     QThread *sdlWorkerThread;
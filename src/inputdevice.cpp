@@ -31,7 +31,9 @@
 
 #include <typeinfo>
 
+#include <QBitArray>
 #include <QDebug>
+#include <QVarLengthArray>
 #include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
@@ -42,6 +44,7 @@ InputDevice::InputDevice(SDL_Joystick *joystick, int deviceIndex, AntiMicroSetti
     buttonDownCount = 0;
     joyNumber = deviceIndex;
     active_set = 0;
+    m_active_set_joystick = nullptr;
     joystickID = 0;
     keyPressTime = 0;
     m_joyhandle = joystick;
@@ -147,24 +150,30 @@ void InputDevice::setActiveSetNumber(int index)
               << " for device with Index: " << getRealJoyNumber();
     if (((index >= 0) && (index < GlobalVariables::InputDevice::NUMBER_JOYSETS)) && (index != active_set))
     {
-        QList<bool> buttonstates;
-        QList<int> axesstates;
-        QList<int> dpadstates;
-        QList<JoyControlStick::JoyStickDirections> stickstates;
-        QList<int> vdpadstates;
-
         // Grab current states for all elements in old set
         SetJoystick *current_set = getJoystick_sets().value(active_set);
         SetJoystick *old_set = current_set;
         SetJoystick *tempSet = getJoystick_sets().value(index);
 
+        QBitArray buttonstates(current_set->getNumberButtons());
+        QVarLengthArray<int, 8> axesstates;
+        QVarLengthArray<int, 4> dpadstates;
+        QVarLengthArray<JoyControlStick::JoyStickDirections, 4> stickstates;
+        QVarLengthArray<int, 4> vdpadstates;
+
+        // Only pressed buttons carry state over to the new set. Released
+        // buttons of the new set are already in the same state.
         for (int i = 0; i < current_set->getNumberButtons(); i++)
         {
             JoyButton *button = current_set->getJoyButton(i);
-            buttonstates.append(button->getButtonState());
-            tempSet->getJoyButton(i)->copyLastMouseDistanceFromDeadZone(button);
-            tempSet->getJoyButton(i)->copyLastAccelerationDistance(button);
-            tempSet->getJoyButton(i)->setUpdateInitAccel(false);
+
+            if (button->getButtonState())
+            {
+                buttonstates.setBit(i);
+                tempSet->getJoyButton(i)->copyLastMouseDistanceFromDeadZone(button);
+                tempSet->getJoyButton(i)->copyLastAccelerationDistance(button);
+                tempSet->getJoyButton(i)->setUpdateInitAccel(false);
+            }
         }
 
         for (int i = 0; i < current_set->getNumberAxes(); i++)
@@ -213,6 +222,7 @@ void InputDevice::setActiveSetNumber(int index)
         // Release all current pressed elements and change set number
         getJoystick_sets().value(active_set)->release();
         active_set = index;
+        m_active_set_joystick = nullptr;
 
         // Activate all buttons in the switched set
         current_set = getJoystick_sets().value(active_set);
@@ -393,7 +403,7 @@ void InputDevice::setActiveSetNumber(int index)
 
         for (int i = 0; i < current_set->getNumberButtons(); i++)
         {
-            bool value = buttonstates.at(i);
+            bool value = buttonstates.testBit(i);
             bool tempignore = false;
             JoyButton *button = current_set->getJoyButton(i);
             JoyButton *oldButton = old_set->getJoyButton(i);
@@ -417,7 +427,8 @@ void InputDevice::setActiveSetNumber(int index)
                 button->setWhileHeldStatus(false);
             }
 
-            button->queuePendingEvent(value, tempignore);
+            if (value)
+                button->queuePendingEvent(value, tempignore);
         }
 
         // Activate all axis buttons in the switched set
@@ -544,7 +555,8 @@ void InputDevice::setActiveSetNumber(int index)
                 }
             }
 
-            dpad->queuePendingEvent(value, tempignore);
+            if (valueTrue)
+                dpad->queuePendingEvent(value, tempignore);
         }
 
         activatePossibleControlStickEvents();
@@ -560,7 +572,17 @@ void InputDevice::setActiveSetNumber(int index)
 
 int InputDevice::getActiveSetNumber() { return active_set; }
 
-SetJoystick *InputDevice::getActiveSetJoystick() { return getJoystick_sets().value(active_set); }
+/**
+ * @brief Get the currently active set. The set objects live as long as the
+ *  device so the pointer is cached until the active set number changes.
+ */
+SetJoystick *InputDevice::getActiveSetJoystick()
+{
+    if (m_active_set_joystick == nullptr)
+        m_active_set_joystick = getJoystick_sets().value(active_set);
+
+    return m_active_set_joystick;
+}
 
 int InputDevice::getNumberButtons() { return getActiveSetJoystick()->getNumberButtons(); }
 
@@ -1737,6 +1759,21 @@ SDL_GameControllerType InputDevice::getControllerType() const { return SDL_CONTR
  */
 InputDeviceCalibration *InputDevice::getCalibrationBackend() { return &m_calibrations; }
 
+/**
+ * @brief Returns the raw element states published by the input thread
+ *   for display in the GUI.
+ */
+InputDeviceStateSnapshot &InputDevice::getStateSnapshot() { return m_state_snapshot; }
+
+/**
+ * @brief Allocates the state snapshot for all raw elements of the device.
+ *   Called by the subclass constructors once the element counts are known.
+ */
+void InputDevice::initStateSnapshot()
+{
+    m_state_snapshot.resize(getNumberRawAxes(), getNumberRawButtons(), getNumberRawHats());
+}
+
 /**
  * @brief Updates stored calibration for this controller and applies
  *   calibration to the specified stick in all sets
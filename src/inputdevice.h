@@ -20,6 +20,7 @@
 #define INPUTDEVICE_H
 
 #include "inputdevicecalibration.h"
+#include "inputdevicestatesnapshot.h"
 #include "joysensordirection.h"
 #include "joysensortype.h"
 #include "setjoystick.h"
@@ -171,8 +172,11 @@ class InputDevice : public QObject
     void updateGyroscopeCalibration(double offsetX, double offsetY, double offsetZ);
     void applyGyroscopeCalibration(double offsetX, double offsetY, double offsetZ);
 
+    InputDeviceStateSnapshot &getStateSnapshot();
+
   protected:
     void enableSetConnections(SetJoystick *setstick);
+    void initStateSnapshot();
 
     QHash<int, JoyAxis::ThrottleTypes> &getCali();
     SDL_JoystickID *getJoystickID();
@@ -181,6 +185,7 @@ class InputDevice : public QObject
     int keyPressTime; // unsigned
     QString profileName;
     InputDeviceCalibration m_calibrations;
+    InputDeviceStateSnapshot m_state_snapshot;
 
   signals:
     void setChangeActivated(int index);
@@ -273,6 +278,7 @@ class InputDevice : public QObject
     QHash<int, JoyAxis::ThrottleTypes> cali;
     AntiMicroSettings *m_settings;
     int active_set;
+    SetJoystick *m_active_set_joystick; // cached joystick_sets.value(active_set)
     int joyNumber;
     int buttonDownCount;
     SDL_JoystickID joystickID;
@@ -17,8 +17,8 @@
 
 #include "inputdevicecalibration.h"
 #include "inputdevice.h"
+#include "profilereader.h"
 
-#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
 /**
@@ -131,9 +131,9 @@ void InputDeviceCalibration::applyCalibrations() const
 
 /**
  * @brief Reads all calibration values from the given XML stream into the internal calibration data storage
- * @param QXmlStreamReader instance that will be used to read calibration values.
+ * @param ProfileReader instance that will be used to read calibration values.
  */
-void InputDeviceCalibration::readConfig(QXmlStreamReader *xml)
+void InputDeviceCalibration::readConfig(ProfileReader *xml)
 {
     while (xml->isStartElement() && (xml->name() == "calibration"))
     {
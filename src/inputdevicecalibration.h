@@ -20,7 +20,7 @@
 #include <QHash>
 
 class InputDevice;
-class QXmlStreamReader;
+class ProfileReader;
 class QXmlStreamWriter;
 
 /**
@@ -94,7 +94,7 @@ class InputDeviceCalibration
     void setGyroscopeCalibration(double offsetX, double offsetY, double offsetZ);
     void applyCalibrations() const;
 
-    void readConfig(QXmlStreamReader *xml);
+    void readConfig(ProfileReader *xml);
     void writeConfig(QXmlStreamWriter *xml) const;
 
   private:
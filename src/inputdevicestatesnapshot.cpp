@@ -0,0 +1,174 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "inputdevicestatesnapshot.h"
+
+#include <QThread>
+
+namespace {
+// Give up after this many torn reads and keep showing the previous state.
+const int MAX_READ_ATTEMPTS = 8;
+} // namespace
+
+InputDeviceStateSnapshot::State::State()
+    : sequence(1)
+{
+    for (int type = 0; type < SENSOR_TYPES; type++)
+    {
+        for (int i = 0; i < 3; i++)
+            sensors[type][i] = 0.0f;
+    }
+}
+
+InputDeviceStateSnapshot::InputDeviceStateSnapshot()
+    : m_sequence(0)
+    , m_axis_count(0)
+    , m_button_count(0)
+    , m_hat_count(0)
+{
+    for (int type = 0; type < SENSOR_TYPES; type++)
+    {
+        for (int i = 0; i < 3; i++)
+            m_sensors[type][i].store(0.0f, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Allocates slots for the given amount of elements and resets them.
+ *  Must be called before the snapshot is shared with another thread.
+ */
+void InputDeviceStateSnapshot::resize(int axes, int buttons, int hats)
+{
+    m_axis_count = qMax(0, axes);
+    m_button_count = qMax(0, buttons);
+    m_hat_count = qMax(0, hats);
+
+    m_axes.reset(new std::atomic<int>[m_axis_count]);
+    m_buttons.reset(new std::atomic<bool>[m_button_count]);
+    m_hats.reset(new std::atomic<int>[m_hat_count]);
+
+    for (int i = 0; i < m_axis_count; i++)
+        m_axes[i].store(0, std::memory_order_relaxed);
+    for (int i = 0; i < m_button_count; i++)
+        m_buttons[i].store(false, std::memory_order_relaxed);
+    for (int i = 0; i < m_hat_count; i++)
+        m_hats[i].store(0, std::memory_order_relaxed);
+
+    m_sequence.store(0, std::memory_order_release);
+}
+
+void InputDeviceStateSnapshot::setAxis(int index, int value)
+{
+    if ((index < 0) || (index >= m_axis_count) || (m_axes[index].load(std::memory_order_relaxed) == value))
+        return;
+
+    beginWrite();
+    m_axes[index].store(value, std::memory_order_relaxed);
+    endWrite();
+}
+
+void InputDeviceStateSnapshot::setButton(int index, bool pressed)
+{
+    if ((index < 0) || (index >= m_button_count) || (m_buttons[index].load(std::memory_order_relaxed) == pressed))
+        return;
+
+    beginWrite();
+    m_buttons[index].store(pressed, std::memory_order_relaxed);
+    endWrite();
+}
+
+void InputDeviceStateSnapshot::setHat(int index, int direction)
+{
+    if ((index < 0) || (index >= m_hat_count) || (m_hats[index].load(std::memory_order_relaxed) == direction))
+        return;
+
+    beginWrite();
+    m_hats[index].store(direction, std::memory_order_relaxed);
+    endWrite();
+}
+
+/**
+ * @brief Stores the X, Y and Z values of a sensor.
+ */
+void InputDeviceStateSnapshot::setSensor(JoySensorType type, const float *values)
+{
+    if ((type < 0) || (type >= SENSOR_TYPES))
+        return;
+
+    beginWrite();
+    for (int i = 0; i < 3; i++)
+        m_sensors[type][i].store(values[i], std::memory_order_relaxed);
+    endWrite();
+}
+
+/**
+ * @brief Copies the current element states if they changed since the last
+ *  read into the given state.
+ * @returns True if the state was updated, false if nothing changed or no
+ *  consistent copy could be made while the input thread was writing.
+ */
+bool InputDeviceStateSnapshot::read(State &state) const
+{
+    state.axes.resize(m_axis_count);
+    state.buttons.resize(m_button_count);
+    state.hats.resize(m_hat_count);
+
+    for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++)
+    {
+        quint32 begin = m_sequence.load(std::memory_order_acquire);
+        if (begin == state.sequence)
+            return false;
+
+        if (begin & 1)
+        {
+            QThread::yieldCurrentThread();
+            continue;
+        }
+
+        for (int i = 0; i < m_axis_count; i++)
+            state.axes[i] = m_axes[i].load(std::memory_order_relaxed);
+        for (int i = 0; i < m_button_count; i++)
+            state.buttons[i] = m_buttons[i].load(std::memory_order_relaxed);
+        for (int i = 0; i < m_hat_count; i++)
+            state.hats[i] = m_hats[i].load(std::memory_order_relaxed);
+        for (int type = 0; type < SENSOR_TYPES; type++)
+        {
+            for (int i = 0; i < 3; i++)
+                state.sensors[type][i] = m_sensors[type][i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == begin)
+        {
+            state.sequence = begin;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void InputDeviceStateSnapshot::beginWrite()
+{
+    m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void InputDeviceStateSnapshot::endWrite()
+{
+    m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
@@ -0,0 +1,88 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "joysensortype.h"
+
+#include <QVector>
+
+#include <atomic>
+#include <memory>
+
+/**
+ * @brief Latest raw element states of one input device, shared between the
+ *  input thread and the GUI.
+ *
+ * Writes come from input event processing, which is serialized by the input
+ * daemon mutex. Every change increments a sequence counter which is odd while
+ * a write is in progress, so readers can copy a consistent state without
+ * locking and without blocking the writer. Instead of receiving a queued
+ * signal per input event, display widgets poll the snapshot at display rate
+ * and skip redraws while the sequence is unchanged.
+ */
+class InputDeviceStateSnapshot
+{
+  public:
+    // Sensor slots are kept even without SDL sensor support.
+    enum
+    {
+        SENSOR_TYPES = GYROSCOPE + 1
+    };
+
+    /**
+     * @brief Copy of the element states as read by the GUI.
+     */
+    struct State
+    {
+        QVector<int> axes;
+        QVector<bool> buttons;
+        QVector<int> hats;
+        float sensors[SENSOR_TYPES][3];
+        // Sequence of the last successful read. Starts odd so the first read
+        // always copies.
+        quint32 sequence;
+
+        State();
+    };
+
+    InputDeviceStateSnapshot();
+
+    InputDeviceStateSnapshot(const InputDeviceStateSnapshot &) = delete;
+    InputDeviceStateSnapshot &operator=(const InputDeviceStateSnapshot &) = delete;
+
+    void resize(int axes, int buttons, int hats);
+
+    void setAxis(int index, int value);
+    void setButton(int index, bool pressed);
+    void setHat(int index, int direction);
+    void setSensor(JoySensorType type, const float *values);
+
+    bool read(State &state) const;
+
+  private:
+    void beginWrite();
+    void endWrite();
+
+    std::atomic<quint32> m_sequence;
+    std::unique_ptr<std::atomic<int>[]> m_axes;
+    std::unique_ptr<std::atomic<bool>[]> m_buttons;
+    std::unique_ptr<std::atomic<int>[]> m_hats;
+    std::atomic<float> m_sensors[SENSOR_TYPES][3];
+    int m_axis_count;
+    int m_button_count;
+    int m_hat_count;
+};
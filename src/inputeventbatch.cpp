@@ -0,0 +1,99 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "inputeventbatch.h"
+
+#include "inputdevice.h"
+#include "joyaxis.h"
+#include "joybuttontypes/joybutton.h"
+#include "joysensor.h"
+
+namespace {
+/**
+ * @brief Checks if activating an event of the button can change the
+ *  active set of its device.
+ */
+bool mayChangeSet(JoyButton *button)
+{
+    return (button->getChangeSetCondition() != JoyButton::SetChangeDisabled) || button->containsSetChangeSlots();
+}
+} // namespace
+
+void InputEventBatch::queueButtonEvent(InputDevice *device, JoyButton *button, bool pressed)
+{
+    bool changesSet = mayChangeSet(button);
+
+    if (m_queued_elements.contains(button) || changesSet)
+        activate();
+
+    button->queuePendingEvent(pressed);
+    m_queued_elements.insert(button);
+    addDevice(device);
+
+    if (changesSet)
+        activate();
+}
+
+void InputEventBatch::queueAxisEvent(InputDevice *device, JoyAxis *axis, int value)
+{
+    if (m_queued_elements.contains(axis))
+        activate();
+
+    axis->queuePendingEvent(value);
+    m_queued_elements.insert(axis);
+    addDevice(device);
+}
+
+/**
+ * @brief Queues a sensor sample. Only the latest sample of a sensor is
+ *  activated, earlier ones are already averaged or dropped while coalescing.
+ */
+void InputEventBatch::queueSensorEvent(InputDevice *device, JoySensor *sensor, float *values)
+{
+    sensor->queuePendingEvent(values);
+    addDevice(device);
+}
+
+/**
+ * @brief Adds a device whose queued events are activated with the next
+ *  activation.
+ */
+void InputEventBatch::addDevice(InputDevice *device) { m_devices.insert(device); }
+
+/**
+ * @brief Activates queued element events of all touched devices and
+ *  invokes pending mouse events.
+ */
+void InputEventBatch::activate()
+{
+    for (InputDevice *device : m_devices)
+    {
+        device->activatePossibleControlStickEvents();
+        device->activatePossibleAxisEvents();
+        device->activatePossibleSensorEvents();
+        device->activatePossibleDPadEvents();
+        device->activatePossibleVDPadEvents();
+        device->activatePossibleButtonEvents();
+    }
+
+    m_devices.clear();
+    m_queued_elements.clear();
+
+    if (JoyButton::shouldInvokeMouseEvents(JoyButton::getPendingMouseButtons(), JoyButton::getStaticMouseEventTimer(),
+                                           JoyButton::getTestOldMouseTime()))
+        JoyButton::invokeMouseEvents(JoyButton::getMouseHelper()); // Do not wait for next event loop run. Execute immediately.
+}
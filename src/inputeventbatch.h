@@ -0,0 +1,52 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QSet>
+
+class InputDevice;
+class JoyAxis;
+class JoyButton;
+class JoySensor;
+
+/**
+ * @brief Queues the element events of one batch of SDL events and
+ *  activates them together.
+ *
+ * Queued events only keep the latest state of an element. Sticks and
+ * virtual D-pads also read the state of their member axes and buttons only
+ * when they are activated. So an element which is queued again before the
+ * batch was activated flushes the batch first, otherwise a short press and
+ * release inside one batch would never reach the mapped buttons. Events of
+ * buttons which can change the active set are activated right away, so
+ * events queued before the set change are handled by the old set and later
+ * ones by the new set.
+ */
+class InputEventBatch
+{
+  public:
+    void queueButtonEvent(InputDevice *device, JoyButton *button, bool pressed);
+    void queueAxisEvent(InputDevice *device, JoyAxis *axis, int value);
+    void queueSensorEvent(InputDevice *device, JoySensor *sensor, float *values);
+
+    void addDevice(InputDevice *device);
+    void activate();
+
+  private:
+    QSet<InputDevice *> m_devices;
+    QSet<const void *> m_queued_elements;
+};
@@ -0,0 +1,73 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "inputtimer.h"
+
+InputTimer::InputTimer()
+    : m_interval(0)
+    , m_single_shot(false)
+    , m_generation(0)
+    , m_scheduler(nullptr)
+    , m_deadline(0)
+{
+}
+
+InputTimer::~InputTimer() { stop(); }
+
+/**
+ * @brief Sets the function which is invoked on expiry.
+ */
+void InputTimer::setCallback(std::function<void()> callback) { m_callback = std::move(callback); }
+
+/**
+ * @brief Sets the timeout interval. Like QTimer, an active timer is restarted.
+ * @param[in] msec Interval in ms.
+ */
+void InputTimer::setInterval(int msec)
+{
+    m_interval = msec;
+
+    if (isActive())
+        start();
+}
+
+void InputTimer::setSingleShot(bool singleShot) { m_single_shot = singleShot; }
+
+/**
+ * @brief Starts or restarts the timer with the current interval.
+ */
+void InputTimer::start()
+{
+    stop();
+
+    InputTimerScheduler *scheduler = InputTimerScheduler::getInstance();
+    scheduler->schedule(this, scheduler->now() + m_interval * 1000000LL);
+}
+
+void InputTimer::start(int msec)
+{
+    m_interval = msec;
+    start();
+}
+
+void InputTimer::stop()
+{
+    m_generation++;
+
+    if (m_scheduler != nullptr)
+        m_scheduler->unschedule(this);
+}
@@ -0,0 +1,62 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "inputtimerscheduler.h"
+
+#include <functional>
+
+/**
+ * @brief Lightweight replacement for QTimer used by JoyButton.
+ *
+ * Instead of owning an OS timer, it only registers its deadline with the
+ * InputTimerScheduler of the calling thread. The API mirrors the subset of
+ * QTimer used by the buttons. A timer must only be used from one thread.
+ */
+class InputTimer
+{
+  public:
+    InputTimer();
+    ~InputTimer();
+
+    InputTimer(const InputTimer &) = delete;
+    InputTimer &operator=(const InputTimer &) = delete;
+
+    void setCallback(std::function<void()> callback);
+    void setInterval(int msec);
+    void setSingleShot(bool singleShot);
+
+    inline int interval() const { return m_interval; }
+    inline bool isSingleShot() const { return m_single_shot; }
+    inline bool isActive() const { return m_scheduler != nullptr; }
+
+    void start();
+    void start(int msec);
+    void stop();
+
+  private:
+    friend class InputTimerScheduler;
+
+    std::function<void()> m_callback;
+    int m_interval;
+    bool m_single_shot;
+    // Incremented on every start and stop to detect stale expiries.
+    unsigned int m_generation;
+    InputTimerScheduler *m_scheduler;
+    qint64 m_deadline;
+    InputTimerScheduler::DeadlineMap::iterator m_position;
+};
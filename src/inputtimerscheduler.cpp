@@ -0,0 +1,173 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "inputtimerscheduler.h"
+
+#include "inputtimer.h"
+
+#include <QThread>
+#include <QThreadStorage>
+
+InputTimerScheduler::InputTimerScheduler(QObject *parent)
+    : QObject(parent)
+    , m_dispatch_frame(nullptr)
+{
+    m_clock.start();
+    m_wakeup.setTimerType(Qt::PreciseTimer);
+    m_wakeup.setSingleShot(true);
+    connect(&m_wakeup, &QTimer::timeout, this, &InputTimerScheduler::dispatch);
+}
+
+InputTimerScheduler::~InputTimerScheduler()
+{
+    for (auto &entry : m_deadlines)
+        entry.second->m_scheduler = nullptr;
+}
+
+/**
+ * @brief Gets the scheduler of the calling thread. It is created on first
+ *  use and destroyed when the thread finishes.
+ */
+InputTimerScheduler *InputTimerScheduler::getInstance()
+{
+    static QThreadStorage<InputTimerScheduler *> schedulers;
+
+    if (!schedulers.hasLocalData())
+        schedulers.setLocalData(new InputTimerScheduler());
+
+    return schedulers.localData();
+}
+
+/**
+ * @brief Gets the current time of the scheduler clock.
+ * @returns Monotonic time in ns.
+ */
+qint64 InputTimerScheduler::now() const { return m_clock.nsecsElapsed(); }
+
+/**
+ * @brief Registers a timer to expire at the given deadline. Timers with an
+ *  equal deadline expire in registration order. Must be called from the
+ *  thread of the scheduler.
+ * @param[in] timer Timer to register, must not be registered already.
+ * @param[in] deadline Expiry time in ns of the scheduler clock.
+ */
+void InputTimerScheduler::schedule(InputTimer *timer, qint64 deadline)
+{
+    Q_ASSERT(QThread::currentThread() == thread());
+
+    timer->m_deadline = deadline;
+    timer->m_position = m_deadlines.emplace(deadline, timer);
+    timer->m_scheduler = this;
+
+    if (timer->m_position == m_deadlines.begin())
+        rearm();
+}
+
+/**
+ * @brief Removes a timer from the scheduler, including pending expiries
+ *  of a running dispatch. Must be called from the thread of the scheduler.
+ */
+void InputTimerScheduler::unschedule(InputTimer *timer)
+{
+    Q_ASSERT(QThread::currentThread() == thread());
+
+    if (timer->m_position != m_deadlines.end())
+    {
+        m_deadlines.erase(timer->m_position);
+        timer->m_position = m_deadlines.end();
+    }
+
+    timer->m_scheduler = nullptr;
+
+    for (DispatchFrame *frame = m_dispatch_frame; frame != nullptr; frame = frame->outer)
+    {
+        for (DueTimer &due : frame->due)
+        {
+            if (due.timer == timer)
+                due.timer = nullptr;
+        }
+    }
+
+    // The wakeup timer is not rearmed here. An early wakeup only
+    // finds nothing to do.
+}
+
+/**
+ * @brief Runs callbacks of all expired timers. Periodic timers are
+ *  registered again before their callback is invoked, so the callback
+ *  can stop or restart them like a QTimer.
+ */
+void InputTimerScheduler::dispatch()
+{
+    DispatchFrame frame;
+    frame.outer = m_dispatch_frame;
+    m_dispatch_frame = &frame;
+
+    qint64 current = now();
+
+    while (!m_deadlines.empty() && (m_deadlines.begin()->first <= current))
+    {
+        InputTimer *timer = m_deadlines.begin()->second;
+        m_deadlines.erase(m_deadlines.begin());
+        timer->m_position = m_deadlines.end();
+        frame.due.append({timer, timer->m_generation});
+    }
+
+    for (int i = 0; i < frame.due.size(); i++)
+    {
+        DueTimer due = frame.due.at(i);
+        InputTimer *timer = due.timer;
+
+        // Stopped or restarted by a previous callback.
+        if ((timer == nullptr) || (timer->m_generation != due.generation))
+            continue;
+
+        if (timer->m_single_shot)
+        {
+            timer->m_scheduler = nullptr;
+        } else
+        {
+            qint64 period = timer->m_interval * 1000000LL;
+            qint64 next = timer->m_deadline + period;
+
+            // Do not try to catch up on missed periods.
+            if (next < current)
+                next = current + period;
+
+            schedule(timer, next);
+        }
+
+        if (timer->m_callback)
+            timer->m_callback();
+    }
+
+    m_dispatch_frame = frame.outer;
+    rearm();
+}
+
+void InputTimerScheduler::rearm()
+{
+    if (m_deadlines.empty())
+    {
+        m_wakeup.stop();
+        return;
+    }
+
+    qint64 remaining = m_deadlines.begin()->first - now();
+    int msec = (remaining > 0) ? static_cast<int>((remaining + 999999) / 1000000) : 0;
+    m_wakeup.start(msec);
+}
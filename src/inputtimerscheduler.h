@@ -0,0 +1,83 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+#include <QVarLengthArray>
+
+#include <map>
+
+class InputTimer;
+
+/**
+ * @brief Central deadline queue for all InputTimer instances of one thread.
+ *
+ * Deadlines are kept ordered by expiry time and registration order, so timers
+ * expiring at the same time always fire in the order they were started.
+ * A single precise QTimer is armed for the earliest deadline.
+ */
+class InputTimerScheduler : public QObject
+{
+    Q_OBJECT
+
+  public:
+    typedef std::multimap<qint64, InputTimer *> DeadlineMap;
+
+    static InputTimerScheduler *getInstance();
+
+    ~InputTimerScheduler();
+
+    qint64 now() const;
+    void schedule(InputTimer *timer, qint64 deadline);
+    void unschedule(InputTimer *timer);
+
+    /**
+     * @brief Gets the amount of currently scheduled timers.
+     */
+    inline int getScheduledCount() const { return static_cast<int>(m_deadlines.size()); }
+
+  private slots:
+    void dispatch();
+
+  private:
+    explicit InputTimerScheduler(QObject *parent = nullptr);
+
+    void rearm();
+
+    struct DueTimer
+    {
+        InputTimer *timer;
+        unsigned int generation;
+    };
+
+    /**
+     * @brief Timers expired in one dispatch run. Linked to allow timer
+     *  callbacks which spin a nested event loop.
+     */
+    struct DispatchFrame
+    {
+        QVarLengthArray<DueTimer, 16> due;
+        DispatchFrame *outer;
+    };
+
+    DeadlineMap m_deadlines;
+    DispatchFrame *m_dispatch_frame;
+    QElapsedTimer m_clock;
+    QTimer m_wakeup;
+};
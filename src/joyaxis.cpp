@@ -23,6 +23,7 @@
 #include "inputdevice.h"
 #include "joyaxis.h"
 #include "joycontrolstick.h"
+#include "logger.h"
 #include "setjoystick.h"
 
 #include <cmath>
@@ -39,6 +40,7 @@ JoyAxis::JoyAxis(int index, int originset, SetJoystick *parentSet, QObject *pare
     : QObject(parent)
 {
     m_stick = nullptr;
+    m_throttle_table = JoyAxisResponse::throttleTable(DEFAULTTHROTTLE);
     lastKnownThottledValue = 0;
     lastKnownRawValue = 0;
     currentRawValue = 0;
@@ -254,46 +256,7 @@ int JoyAxis::getCurrentThrottledValue() { return currentThrottledValue; }
 
 void JoyAxis::updateCurrentThrottledValue(int newValue) { currentThrottledValue = newValue; }
 
-int JoyAxis::calculateThrottledValue(int value)
-{
-    // QScopedPointer<LogHelper> log(new DEBUG());
-    // *log << "Throttled value at start of function is: " << value;
-
-    int temp = value;
-
-    switch (throttle)
-    {
-    case -2:
-        // *log << ". It's a negative half throttle.";
-
-        value = (value <= 0) ? value : -value;
-        temp = value;
-        break;
-
-    case -1:
-        // *log << ". It's a negative throttle.";
-
-        temp = (value + GlobalVariables::JoyAxis::AXISMIN) / 2;
-        break;
-
-    case 1:
-        // *log << ". It's a positive throttle.";
-
-        temp = (value + GlobalVariables::JoyAxis::AXISMAX) / 2;
-        break;
-
-    case 2:
-        // *log << ". It's a positive half throttle.";
-
-        value = (value >= 0) ? value : -value;
-        temp = value;
-        break;
-    }
-
-    // *log << " Calculated value of throttle is: " << temp;
-
-    return temp;
-}
+int JoyAxis::calculateThrottledValue(int value) { return JoyAxisResponse::throttledValue(m_throttle_table, value); }
 
 /**
  * @brief Checks if the axis supports haptic trigger feedback.
@@ -358,6 +321,7 @@ void JoyAxis::setDeadZone(int value)
         return;
 
     deadZone = value;
+    updateZoneRange();
     emit propertyUpdated();
     emit hapticTriggerChanged();
 }
@@ -371,12 +335,13 @@ void JoyAxis::setMaxZoneValue(int value)
     if (value >= GlobalVariables::JoyAxis::AXISMAX)
     {
         maxZoneValue = GlobalVariables::JoyAxis::AXISMAX;
-        emit propertyUpdated();
     } else
     {
         maxZoneValue = value;
-        emit propertyUpdated();
     }
+
+    updateZoneRange();
+    emit propertyUpdated();
 }
 
 int JoyAxis::getMaxZoneValue() { return maxZoneValue; }
@@ -387,14 +352,14 @@ int JoyAxis::getMaxZoneValue() { return maxZoneValue; }
  */
 void JoyAxis::setThrottle(int value)
 {
-    qDebug() << "Value of throttle for axis in setThrottle is: " << value;
+    TRACE() << "Value of throttle for axis in setThrottle is: " << value;
 
     if ((value >= static_cast<int>(JoyAxis::NegativeHalfThrottle)) &&
         (value <= static_cast<int>(JoyAxis::PositiveHalfThrottle)))
     {
         if (value != throttle)
         {
-            qDebug() << "Throttle value for variable \"throttle\" has been set: " << value;
+            TRACE() << "Throttle value for variable \"throttle\" has been set: " << value;
 
             throttle = value;
             adjustRange();
@@ -432,6 +397,8 @@ void JoyAxis::resetPrivateVars()
     eventActive = false;
     maxZoneValue = GlobalVariables::JoyAxis::AXISMAXZONE;
     throttle = this->DEFAULTTHROTTLE;
+    m_response_curve = JoyAxisCurve();
+    updateZoneRange();
 
     paxisbutton->reset();
     naxisbutton->reset();
@@ -477,28 +444,39 @@ void JoyAxis::adjustRange()
         currentThrottledDeadValue = GlobalVariables::JoyAxis::AXISMIN;
     }
 
+    m_throttle_table = JoyAxisResponse::throttleTable(throttle);
     currentThrottledValue = calculateThrottledValue(currentRawValue);
 }
 
 int JoyAxis::getCurrentThrottledDeadValue() { return currentThrottledDeadValue; }
 
+/**
+ * @brief Selects the distance table of the current configuration. Has to be
+ *  called whenever the dead zone, max zone or response curve changes, so
+ *  that reading the distance never replaces the table.
+ */
+void JoyAxis::updateZoneRange() { m_response = JoyAxisResponse::get(deadZone, maxZoneValue, m_response_curve); }
+
 double JoyAxis::getDistanceFromDeadZone() { return getDistanceFromDeadZone(currentThrottledValue); }
 
-double JoyAxis::getDistanceFromDeadZone(int value)
-{
-    double distance = 0.0;
+double JoyAxis::getDistanceFromDeadZone(int value) { return m_response->distance(value); }
 
-    if (value >= deadZone)
-    {
-        distance = static_cast<double>(value - deadZone) / (maxZoneValue - deadZone);
-    } else if (value <= -deadZone)
-    {
-        distance = static_cast<double>(value + deadZone) / ((-maxZoneValue) + deadZone);
-    }
+/**
+ * @brief Sets the curve which maps the distance beyond the dead zone to the
+ *  distance used by the axis buttons.
+ */
+void JoyAxis::setResponseCurve(const JoyAxisCurve &curve)
+{
+    if (curve == m_response_curve)
+        return;
 
-    return qBound(0.0, distance, 1.0);
+    m_response_curve = curve;
+    updateZoneRange();
+    emit propertyUpdated();
 }
 
+const JoyAxisCurve &JoyAxis::getResponseCurve() const { return m_response_curve; }
+
 /**
  * @brief Get the current value for an axis in either direction converted to
  *   the range of -1.0 to 1.0.
@@ -567,6 +545,7 @@ bool JoyAxis::isDefault()
     bool value = true;
     value = value && (deadZone == getDefaultDeadZone());
     value = value && (maxZoneValue == getDefaultMaxZone());
+    value = value && m_response_curve.isEmpty();
     value = value && (paxisbutton->isDefault());
     value = value && (naxisbutton->isDefault());
 
@@ -692,16 +671,16 @@ JoyAxisButton *JoyAxis::getAxisButtonByValue(int value)
     JoyAxisButton *eventbutton = nullptr;
     int throttledValue = calculateThrottledValue(value);
 
-    qDebug() << "throttledValue in getAxisButtonByValue is: " << throttledValue;
+    TRACE() << "throttledValue in getAxisButtonByValue is: " << throttledValue;
 
     if (throttledValue > deadZone)
     {
-        qDebug() << "throtted value is positive";
+        TRACE() << "throtted value is positive";
 
         eventbutton = paxisbutton;
     } else if (throttledValue < (-deadZone))
     {
-        qDebug() << "throtted value is negative";
+        TRACE() << "throtted value is negative";
 
         eventbutton = naxisbutton;
     }
@@ -822,6 +801,8 @@ void JoyAxis::copyAssignments(JoyAxis *destAxis)
     destAxis->reset();
     destAxis->deadZone = deadZone;
     destAxis->maxZoneValue = maxZoneValue;
+    destAxis->m_response_curve = m_response_curve;
+    destAxis->updateZoneRange();
     destAxis->axisName = axisName;
     paxisbutton->copyAssignments(destAxis->paxisbutton);
     naxisbutton->copyAssignments(destAxis->naxisbutton);
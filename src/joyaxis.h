@@ -23,6 +23,7 @@
 #include <QObject>
 
 #include "haptictriggermodeps5.h"
+#include "joyaxisresponse.h"
 #include "joybuttontypes/joyaxisbutton.h"
 
 class HapticTriggerPs5;
@@ -89,6 +90,9 @@ class JoyAxis : public QObject
     double getDistanceFromDeadZone(int value);
     double getRawDistance(int value);
 
+    void setResponseCurve(const JoyAxisCurve &curve);
+    const JoyAxisCurve &getResponseCurve() const;
+
     void setControlStick(JoyControlStick *stick);
     void removeControlStick(bool performRelease = true);
     bool isPartControlStick();
@@ -162,6 +166,7 @@ class JoyAxis : public QObject
   protected:
     void createDeskEvent(bool ignoresets = false); // JoyAxisEvent class
     void adjustRange();
+    void updateZoneRange();
 
     void performCalibration(int value);
     void stickPassEvent(int value, bool ignoresets = false, bool updateLastValues = true); // JoyAxisEvent class
@@ -175,6 +180,7 @@ class JoyAxis : public QObject
     int throttle;
     int deadZone;
     int maxZoneValue;
+    JoyAxisCurve m_response_curve;
     int currentRawValue;
     int currentThrottledValue;
     int currentThrottledDeadValue;
@@ -228,6 +234,11 @@ class JoyAxis : public QObject
     double m_offset;
     double m_gain;
 
+    // Tables for the current throttle and zone configuration. The distance
+    // table is fetched on first use after the configuration changed.
+    const int *m_throttle_table;
+    QSharedPointer<const JoyAxisResponse> m_response;
+
     void resetPrivateVars();
 };
 
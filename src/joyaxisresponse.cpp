@@ -0,0 +1,299 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "joyaxisresponse.h"
+
+#include "globalvariables.h"
+
+#include <QByteArray>
+#include <QHash>
+#include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPair>
+#include <QWeakPointer>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+const int TABLE_SIZE = 65536;
+
+QVector<int> buildThrottleTable(int throttle)
+{
+    QVector<int> table(TABLE_SIZE);
+
+    for (int i = 0; i < TABLE_SIZE; i++)
+    {
+        int value = i - 32768;
+
+        switch (throttle)
+        {
+        case -2:
+            value = (value <= 0) ? value : -value;
+            break;
+
+        case -1:
+            value = (value + GlobalVariables::JoyAxis::AXISMIN) / 2;
+            break;
+
+        case 1:
+            value = (value + GlobalVariables::JoyAxis::AXISMAX) / 2;
+            break;
+
+        case 2:
+            value = (value >= 0) ? value : -value;
+            break;
+        }
+
+        table[i] = value;
+    }
+
+    return table;
+}
+
+template <int Throttle> const int *throttleTableFor()
+{
+    static const QVector<int> table = buildThrottleTable(Throttle);
+    return table.constData();
+}
+
+/**
+ * @brief Evaluates a JoyAxisCurve. Spline tangents follow the Fritsch-Carlson
+ *  method, so the curve never overshoots between two points.
+ */
+class CurveEvaluator
+{
+  public:
+    explicit CurveEvaluator(const JoyAxisCurve &curve)
+        : m_spline(curve.spline)
+    {
+        QMap<double, double> knots;
+        knots.insert(0.0, 0.0);
+        knots.insert(1.0, 1.0);
+
+        for (const QPointF &point : curve.points)
+            knots.insert(qBound(0.0, point.x(), 1.0), qBound(0.0, point.y(), 1.0));
+
+        for (auto iter = knots.constBegin(); iter != knots.constEnd(); ++iter)
+        {
+            m_x.append(iter.key());
+            m_y.append(iter.value());
+        }
+
+        if (m_spline)
+            calculateTangents();
+    }
+
+    double map(double x) const
+    {
+        int k = static_cast<int>(std::upper_bound(m_x.constBegin(), m_x.constEnd(), x) - m_x.constBegin()) - 1;
+        k = qBound(0, k, m_x.size() - 2);
+
+        double h = m_x.at(k + 1) - m_x.at(k);
+        double t = (x - m_x.at(k)) / h;
+
+        if (!m_spline)
+            return m_y.at(k) + t * (m_y.at(k + 1) - m_y.at(k));
+
+        double t2 = t * t;
+        double t3 = t2 * t;
+        double y = (2 * t3 - 3 * t2 + 1) * m_y.at(k) + (t3 - 2 * t2 + t) * h * m_tangents.at(k) +
+                   (-2 * t3 + 3 * t2) * m_y.at(k + 1) + (t3 - t2) * h * m_tangents.at(k + 1);
+        return qBound(0.0, y, 1.0);
+    }
+
+  private:
+    void calculateTangents()
+    {
+        int count = m_x.size();
+        QVector<double> slopes(count - 1);
+
+        for (int k = 0; k < count - 1; k++)
+            slopes[k] = (m_y.at(k + 1) - m_y.at(k)) / (m_x.at(k + 1) - m_x.at(k));
+
+        m_tangents.resize(count);
+        m_tangents[0] = slopes.first();
+        m_tangents[count - 1] = slopes.last();
+
+        for (int k = 1; k < count - 1; k++)
+            m_tangents[k] = (slopes.at(k - 1) * slopes.at(k) <= 0.0) ? 0.0 : (slopes.at(k - 1) + slopes.at(k)) / 2;
+
+        for (int k = 0; k < count - 1; k++)
+        {
+            if (qFuzzyIsNull(slopes.at(k)))
+            {
+                m_tangents[k] = 0.0;
+                m_tangents[k + 1] = 0.0;
+                continue;
+            }
+
+            double a = m_tangents.at(k) / slopes.at(k);
+            double b = m_tangents.at(k + 1) / slopes.at(k);
+            double length = a * a + b * b;
+
+            if (length > 9.0)
+            {
+                double scale = 3.0 / std::sqrt(length);
+                m_tangents[k] = scale * a * slopes.at(k);
+                m_tangents[k + 1] = scale * b * slopes.at(k);
+            }
+        }
+    }
+
+    bool m_spline;
+    QVector<double> m_x;
+    QVector<double> m_y;
+    QVector<double> m_tangents;
+};
+
+QByteArray responseKey(int deadZone, int maxZone, const JoyAxisCurve &curve)
+{
+    QByteArray key;
+    key.append(reinterpret_cast<const char *>(&deadZone), sizeof(deadZone));
+    key.append(reinterpret_cast<const char *>(&maxZone), sizeof(maxZone));
+
+    if (!curve.isEmpty())
+    {
+        key.append(curve.spline ? 's' : 'l');
+        key.append(reinterpret_cast<const char *>(curve.points.constData()),
+                   static_cast<int>(curve.points.size() * sizeof(QPointF)));
+    }
+
+    return key;
+}
+} // namespace
+
+JoyAxisCurve::JoyAxisCurve()
+    : spline(false)
+{
+}
+
+bool JoyAxisCurve::isEmpty() const { return points.isEmpty(); }
+
+bool JoyAxisCurve::operator==(const JoyAxisCurve &other) const
+{
+    return (points == other.points) && (isEmpty() || (spline == other.spline));
+}
+
+bool JoyAxisCurve::operator!=(const JoyAxisCurve &other) const { return !(*this == other); }
+
+/**
+ * @brief Gets the table which maps a raw axis value to its throttled value.
+ */
+const int *JoyAxisResponse::throttleTable(int throttle)
+{
+    switch (throttle)
+    {
+    case -2:
+        return throttleTableFor<-2>();
+
+    case -1:
+        return throttleTableFor<-1>();
+
+    case 1:
+        return throttleTableFor<1>();
+
+    case 2:
+        return throttleTableFor<2>();
+
+    default:
+        return throttleTableFor<0>();
+    }
+}
+
+/**
+ * @brief Gets the distance table for an axis configuration. The table is
+ *  built on first use and released after the last axis using it changed
+ *  its configuration.
+ */
+QSharedPointer<const JoyAxisResponse> JoyAxisResponse::get(int deadZone, int maxZone, const JoyAxisCurve &curve)
+{
+    static QMutex mutex;
+    static QHash<QByteArray, QWeakPointer<const JoyAxisResponse>> responses;
+
+    QByteArray key = responseKey(deadZone, maxZone, curve);
+    QMutexLocker locker(&mutex);
+    QSharedPointer<const JoyAxisResponse> response = responses.value(key).toStrongRef();
+
+    if (response.isNull())
+    {
+        auto iter = responses.begin();
+
+        while (iter != responses.end())
+        {
+            if (iter.value().isNull())
+                iter = responses.erase(iter);
+            else
+                ++iter;
+        }
+
+        response = QSharedPointer<const JoyAxisResponse>(new JoyAxisResponse(deadZone, maxZone, curve));
+        responses.insert(key, response);
+    }
+
+    return response;
+}
+
+JoyAxisResponse::JoyAxisResponse(int deadZone, int maxZone, const JoyAxisCurve &curve)
+    : m_distances(TABLE_SIZE)
+{
+    CurveEvaluator evaluator(curve);
+    double range = maxZone - deadZone;
+
+    for (int i = 0; i < TABLE_SIZE; i++)
+    {
+        int value = std::abs(i - 32768);
+        double distance = 0.0;
+
+        if (value > deadZone)
+        {
+            distance = (range > 0) ? qBound(0.0, (value - deadZone) / range, 1.0) : 1.0;
+
+            if (!curve.isEmpty())
+                distance = evaluator.map(distance);
+        }
+
+        m_distances[i] = static_cast<float>(distance);
+    }
+}
+
+/**
+ * @brief Gets the table of a mouse curve. Curves are identified by the curve
+ *  type and its parameter, function is only called to build a new table.
+ */
+const JoyMouseCurveResponse *JoyMouseCurveResponse::get(int curve, double parameter, Function function)
+{
+    static QMutex mutex;
+    static QHash<QPair<int, double>, const JoyMouseCurveResponse *> responses;
+
+    QMutexLocker locker(&mutex);
+    const JoyMouseCurveResponse *&response = responses[qMakePair(curve, parameter)];
+
+    if (response == nullptr)
+        response = new JoyMouseCurveResponse(parameter, function);
+
+    return response;
+}
+
+JoyMouseCurveResponse::JoyMouseCurveResponse(double parameter, Function function)
+    : m_values(SEGMENTS + 1)
+{
+    for (int i = 0; i <= SEGMENTS; i++)
+        m_values[i] = function(static_cast<double>(i) / SEGMENTS, parameter);
+}
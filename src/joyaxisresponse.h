@@ -0,0 +1,101 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QPointF>
+#include <QSharedPointer>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief User defined response curve of an axis.
+ *
+ * Maps the distance of the axis beyond its dead zone to the distance used by
+ * the axis buttons, both in the range of 0.0 to 1.0. The curve passes through
+ * (0.0, 0.0), the given points and (1.0, 1.0) unless a point overrides one of
+ * the end points. It is either linear between the points or a monotone cubic
+ * spline through them. An empty curve is linear.
+ */
+struct JoyAxisCurve
+{
+    JoyAxisCurve();
+
+    bool isEmpty() const;
+    bool operator==(const JoyAxisCurve &other) const;
+    bool operator!=(const JoyAxisCurve &other) const;
+
+    QVector<QPointF> points;
+    bool spline;
+};
+
+/**
+ * @brief Precalculated response of an axis for every 16 bit input value.
+ *
+ * Throttle tables only depend on the throttle mode and are built once per
+ * process. Distance tables combine dead zone, max zone and response curve.
+ * They are shared by all axes with the same configuration, so the default
+ * axes of every set use a single table.
+ */
+class JoyAxisResponse
+{
+  public:
+    static const int *throttleTable(int throttle);
+    static QSharedPointer<const JoyAxisResponse> get(int deadZone, int maxZone, const JoyAxisCurve &curve);
+
+    static int throttledValue(const int *table, int value) { return table[index(value)]; }
+    double distance(int value) const { return m_distances.at(index(value)); }
+
+  private:
+    JoyAxisResponse(int deadZone, int maxZone, const JoyAxisCurve &curve);
+
+    // Values outside of the 16 bit range, e.g. after calibration, use the
+    // entry of the nearest limit.
+    static int index(int value) { return qBound(-32768, value, 32767) + 32768; }
+
+    QVector<float> m_distances;
+};
+
+/**
+ * @brief Precalculated mouse curve of a button.
+ *
+ * Maps the distance of an element from its dead zone to the distance used
+ * for the mouse speed. The curve is sampled at evenly spaced distances and
+ * interpolated linearly between the samples. Tables are shared by all buttons
+ * with the same curve and are kept until the program exits, so the mouse
+ * timer can still read a table while the GUI assigns another curve.
+ */
+class JoyMouseCurveResponse
+{
+  public:
+    typedef double (*Function)(double distance, double parameter);
+
+    static const JoyMouseCurveResponse *get(int curve, double parameter, Function function);
+
+    double map(double distance) const
+    {
+        double position = qBound(0.0, distance, 1.0) * SEGMENTS;
+        int index = qMin(static_cast<int>(position), SEGMENTS - 1);
+        return m_values.at(index) + (position - index) * (m_values.at(index + 1) - m_values.at(index));
+    }
+
+  private:
+    static const int SEGMENTS = 4096;
+
+    JoyMouseCurveResponse(double parameter, Function function);
+
+    QVector<double> m_values;
+};
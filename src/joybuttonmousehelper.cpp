@@ -18,6 +18,7 @@
 
 #include "joybuttonmousehelper.h"
 
+#include "event.h"
 #include "globalvariables.h"
 #include "joybuttontypes/joybutton.h"
 
@@ -39,13 +40,11 @@ void JoyButtonMouseHelper::moveMouseCursor()
     int finalx = 0;
     int finaly = 0;
     int elapsedTime = 5;
-    JoyButton::moveMouseCursor(finalx, finaly, elapsedTime, &GlobalVariables::JoyButton::mouseHistoryX,
-                               &GlobalVariables::JoyButton::mouseHistoryY, JoyButton::getTestOldMouseTime(),
-                               JoyButton::getStaticMouseEventTimer(), GlobalVariables::JoyButton::mouseRefreshRate,
-                               GlobalVariables::JoyButton::mouseHistorySize, JoyButton::getCursorXSpeeds(),
+    JoyButton::moveMouseCursor(finalx, finaly, elapsedTime, &GlobalVariables::JoyButton::mouseHistory,
+                               JoyButton::getTestOldMouseTime(), JoyButton::getStaticMouseEventTimer(),
+                               GlobalVariables::JoyButton::mouseRefreshPeriodUsec, JoyButton::getCursorXSpeeds(),
                                JoyButton::getCursorYSpeeds(), GlobalVariables::JoyButton::cursorRemainderX,
-                               GlobalVariables::JoyButton::cursorRemainderY, GlobalVariables::JoyButton::weightModifier,
-                               GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE, JoyButton::getPendingMouseButtons());
+                               GlobalVariables::JoyButton::cursorRemainderY, JoyButton::getPendingMouseButtons());
 
     if ((finalx != 0) || (finaly != 0))
         emit mouseCursorMoved(finalx, finaly, elapsedTime);
@@ -61,8 +60,7 @@ void JoyButtonMouseHelper::moveSpringMouse()
     bool hasMoved = false;
     JoyButton::moveSpringMouse(finalx, finaly, hasMoved, GlobalVariables::JoyButton::springModeScreen,
                                JoyButton::getSpringXSpeeds(), JoyButton::getSpringYSpeeds(),
-                               JoyButton::getPendingMouseButtons(), GlobalVariables::JoyButton::mouseRefreshRate,
-                               GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE, JoyButton::getStaticMouseEventTimer());
+                               JoyButton::getPendingMouseButtons(), JoyButton::getStaticMouseEventTimer());
 
     if (hasMoved)
         emit mouseSpringMoved(finalx, finaly);
@@ -73,6 +71,8 @@ void JoyButtonMouseHelper::moveSpringMouse()
  */
 void JoyButtonMouseHelper::mouseEvent()
 {
+    beginOutputBatch();
+
     if (!JoyButton::hasCursorEvents(JoyButton::getCursorXSpeeds(), JoyButton::getCursorYSpeeds()) &&
         !JoyButton::hasSpringEvents(JoyButton::getSpringXSpeeds(), JoyButton::getSpringYSpeeds()))
     {
@@ -95,6 +95,8 @@ void JoyButtonMouseHelper::mouseEvent()
 
     JoyButton::restartLastMouseTime(JoyButton::getTestOldMouseTime());
     firstSpringEvent = false;
+
+    flushOutputBatch();
 }
 
 void JoyButtonMouseHelper::resetButtonMouseDistances()
@@ -115,10 +117,12 @@ bool JoyButtonMouseHelper::getFirstSpringStatus() { return firstSpringEvent; }
 
 void JoyButtonMouseHelper::carryGamePollRateUpdate(int pollRate) { emit gamepadRefreshRateUpdated(pollRate); }
 
+void JoyButtonMouseHelper::carryGamepadEventDrivenUpdate(bool eventDriven) { emit gamepadEventDrivenUpdated(eventDriven); }
+
 void JoyButtonMouseHelper::carryMouseRefreshRateUpdate(int refreshRate) { emit mouseRefreshRateUpdated(refreshRate); }
 
 void JoyButtonMouseHelper::changeThread(QThread *thread)
 {
     JoyButton::setStaticMouseThread(thread, JoyButton::getStaticMouseEventTimer(), JoyButton::getTestOldMouseTime(),
-                                    GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE, JoyButton::getMouseHelper());
+                                    JoyButton::getMouseHelper());
 }
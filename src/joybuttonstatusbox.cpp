@@ -31,26 +31,22 @@ JoyButtonStatusBox::JoyButtonStatusBox(JoyButton *button, QWidget *parent)
     isflashing = false;
 
     setText(QString::number(button->getRealJoyNumber()));
-
-    connect(button, &JoyButton::clicked, this, &JoyButtonStatusBox::flash);
-    connect(button, &JoyButton::released, this, &JoyButtonStatusBox::unflash);
 }
 
 JoyButton *JoyButtonStatusBox::getJoyButton() const { return button; }
 
 bool JoyButtonStatusBox::isButtonFlashing() { return isflashing; }
 
-void JoyButtonStatusBox::flash()
+/**
+ * @brief Changes the highlight of the box. The style is only
+ *  refreshed if the state actually changed.
+ */
+void JoyButtonStatusBox::setFlashing(bool flashing)
 {
-    isflashing = true;
-
-    this->style()->unpolish(this);
-    this->style()->polish(this);
-}
+    if (flashing == isflashing)
+        return;
 
-void JoyButtonStatusBox::unflash()
-{
-    isflashing = false;
+    isflashing = flashing;
 
     this->style()->unpolish(this);
     this->style()->polish(this);
@@ -33,10 +33,7 @@ class JoyButtonStatusBox : public QPushButton
     explicit JoyButtonStatusBox(JoyButton *button, QWidget *parent = nullptr);
     JoyButton *getJoyButton() const;
     bool isButtonFlashing();
-
-  private slots:
-    void flash();
-    void unflash();
+    void setFlashing(bool flashing);
 
   private:
     JoyButton *button;
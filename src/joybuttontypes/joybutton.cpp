@@ -20,6 +20,7 @@
 
 #include "event.h"
 #include "inputdevice.h"
+#include "joyaxisresponse.h"
 #include "logger.h"
 #include "setjoystick.h"
 #include "vdpad.h"
@@ -36,6 +37,104 @@
 #include <QtConcurrent>
 #include <chrono>
 
+namespace {
+double linearCurve(double distance, double parameter)
+{
+    Q_UNUSED(parameter)
+    return distance;
+}
+
+double quadraticCurve(double distance, double parameter)
+{
+    Q_UNUSED(parameter)
+    return distance * distance;
+}
+
+double cubicCurve(double distance, double parameter)
+{
+    Q_UNUSED(parameter)
+    return distance * distance * distance;
+}
+
+double quadraticExtremeCurve(double distance, double parameter)
+{
+    Q_UNUSED(parameter)
+    double result = distance * distance;
+    return (distance >= 0.95) ? (result * 1.5) : result;
+}
+
+double powerCurve(double distance, double sensitivity)
+{
+    double tempsensitive = qMin(qMax(sensitivity, 1.0e-3), 1.0e+3);
+    return qMin(qMax(pow(distance, 1.0 / tempsensitive), 0.0), 1.0);
+}
+
+/**
+ * @brief Performs different forms of acceleration depending on the range of
+ *  the element from its assigned dead zone. Useful for more precise controls
+ *  with an axis.
+ */
+double enhancedPrecisionCurve(double distance, double parameter)
+{
+    Q_UNUSED(parameter)
+
+    if (distance <= 0.4)
+    {
+        // Low slope value for really slow acceleration
+        return distance * 0.37;
+    } else if (distance <= 0.75)
+    {
+        // Perform Linear accleration with an appropriate offset.
+        return distance - 0.252;
+    }
+
+    // Perform mouse acceleration. Make up the difference due to the previous
+    // two segments. Maxes out at 1.0.
+    return (distance * 2.008) - 1.008;
+}
+
+/**
+ * @brief Gets the function of a mouse curve which can be precalculated.
+ * @returns nullptr for the easing curves
+ */
+JoyMouseCurveResponse::Function mouseCurveFunction(JoyButton::JoyMouseCurve curve)
+{
+    switch (curve)
+    {
+    case JoyButton::QuadraticCurve:
+        return quadraticCurve;
+
+    case JoyButton::CubicCurve:
+        return cubicCurve;
+
+    case JoyButton::QuadraticExtremeCurve:
+        return quadraticExtremeCurve;
+
+    case JoyButton::PowerCurve:
+        return powerCurve;
+
+    case JoyButton::EnhancedPrecisionCurve:
+        return enhancedPrecisionCurve;
+
+    case JoyButton::EasingQuadraticCurve:
+    case JoyButton::EasingCubicCurve:
+        return nullptr;
+
+    default:
+        return linearCurve;
+    }
+}
+
+/**
+ * @brief Only the power curve depends on the sensitivity. All other curves
+ *  share one table regardless of it.
+ */
+double mouseCurveParameter(JoyButton::JoyMouseCurve curve, double sensitivity)
+{
+    return (curve == JoyButton::PowerCurve) ? sensitivity : 0.0;
+}
+} // namespace
+
 const JoyButton::JoyMouseCurve JoyButton::DEFAULTMOUSECURVE = JoyButton::EnhancedPrecisionCurve;
 const JoyButton::SetChangeCondition JoyButton::DEFAULTSETCONDITION = JoyButton::SetChangeDisabled;
 const JoyButton::JoyMouseMovementMode JoyButton::DEFAULTMOUSEMODE = JoyButton::MouseCursor;
@@ -68,7 +167,7 @@ int JoyButton::allSlotTimeBetweenSlots = 0;
 // instances.
 JoyButtonMouseHelper JoyButton::mouseHelper;
 
-QTimer JoyButton::staticMouseEventTimer;
+MouseEventScheduler JoyButton::staticMouseEventTimer;
 QList<JoyButton *> JoyButton::pendingMouseButtons;
 
 // IT CAN BE HERE
@@ -81,33 +180,21 @@ JoyButton::JoyButton(int sdl_button_index, int originset, SetJoystick *parentSet
 
     threadPool = QThreadPool::globalInstance();
 
-    turboTimer.setParent(this);
-    pauseTimer.setParent(this);
-    holdTimer.setParent(this);
-    pauseWaitTimer.setParent(this);
-    createDeskTimer.setParent(this);
-    releaseDeskTimer.setParent(this);
-    mouseWheelVerticalEventTimer.setParent(this);
-    mouseWheelHorizontalEventTimer.setParent(this);
-    setChangeTimer.setParent(this);
-    keyPressTimer.setParent(this);
-    delayTimer.setParent(this);
-    slotSetChangeTimer.setParent(this);
     setChangeTimer.setSingleShot(true);
     slotSetChangeTimer.setSingleShot(true);
     m_parentSet = parentSet;
 
-    connect(&pauseWaitTimer, &QTimer::timeout, this, &JoyButton::pauseWaitEvent);
-    connect(&keyPressTimer, &QTimer::timeout, this, &JoyButton::keyPressEvent);
-    connect(&holdTimer, &QTimer::timeout, this, &JoyButton::holdEvent);
-    connect(&delayTimer, &QTimer::timeout, this, &JoyButton::delayEvent);
-    connect(&createDeskTimer, &QTimer::timeout, this, &JoyButton::waitForDeskEvent);
-    connect(&releaseDeskTimer, &QTimer::timeout, this, &JoyButton::waitForReleaseDeskEvent);
-    connect(&turboTimer, &QTimer::timeout, this, &JoyButton::turboEvent);
-    connect(&mouseWheelVerticalEventTimer, &QTimer::timeout, this, &JoyButton::wheelEventVertical);
-    connect(&mouseWheelHorizontalEventTimer, &QTimer::timeout, this, &JoyButton::wheelEventHorizontal);
-    connect(&setChangeTimer, &QTimer::timeout, this, &JoyButton::checkForSetChange);
-    connect(&slotSetChangeTimer, &QTimer::timeout, this, &JoyButton::slotSetChange);
+    pauseWaitTimer.setCallback([this] { pauseWaitEvent(); });
+    keyPressTimer.setCallback([this] { keyPressEvent(); });
+    holdTimer.setCallback([this] { holdEvent(); });
+    delayTimer.setCallback([this] { delayEvent(); });
+    createDeskTimer.setCallback([this] { waitForDeskEvent(); });
+    releaseDeskTimer.setCallback([this] { waitForReleaseDeskEvent(); });
+    turboTimer.setCallback([this] { turboEvent(); });
+    mouseWheelVerticalEventTimer.setCallback([this] { wheelEventVertical(); });
+    mouseWheelHorizontalEventTimer.setCallback([this] { wheelEventHorizontal(); });
+    setChangeTimer.setCallback([this] { checkForSetChange(); });
+    slotSetChangeTimer.setCallback([this] { slotSetChange(); });
 
     // Will only matter on the first call
     establishMouseTimerConnections();
@@ -247,16 +334,16 @@ void JoyButton::joyEvent(bool pressed, bool ignoresets)
             {
                 if (isButtonPressed && activePress && !turboTimer.isActive())
                 {
-                    startSequenceOfPressActive(true, tr("Processing turbo for #%1 - %2"));
+                    startSequenceOfPressActive(true, "Processing turbo for #%1 - %2");
                     turboEvent();
                 } else if (!isButtonPressed && !activePress && turboTimer.isActive())
                 {
                     turboTimer.stop();
 
                     Q_ASSERT(!m_parentSet.isNull());
-                    qDebug() << tr("Finishing turbo for button #%1 - %2")
-                                    .arg(m_parentSet->getInputDevice()->getRealJoyNumber())
-                                    .arg(getPartialName());
+                    TRACE() << tr("Finishing turbo for button #%1 - %2")
+                                   .arg(m_parentSet->getInputDevice()->getRealJoyNumber())
+                                   .arg(getPartialName());
 
                     if (isKeyPressed)
                         turboEvent();
@@ -282,9 +369,9 @@ void JoyButton::joyEvent(bool pressed, bool ignoresets)
                 }
             } else if (!isButtonPressed && !activePress)
             {
-                qDebug() << QString("Processing release for button #%1 - %2")
-                                .arg(m_parentSet->getInputDevice()->getRealJoyNumber())
-                                .arg(getPartialName());
+                TRACE() << QString("Processing release for button #%1 - %2")
+                               .arg(m_parentSet->getInputDevice()->getRealJoyNumber())
+                               .arg(getPartialName());
 
                 waitForReleaseDeskEvent();
             }
@@ -308,9 +395,9 @@ void JoyButton::updateParamsAfterDistEvent()
 {
     if (distanceEvent())
     {
-        qDebug() << tr("Distance change for button #%1 - %2")
-                        .arg(m_parentSet->getInputDevice()->getRealJoyNumber())
-                        .arg(getPartialName());
+        TRACE() << tr("Distance change for button #%1 - %2")
+                       .arg(m_parentSet->getInputDevice()->getRealJoyNumber())
+                       .arg(getPartialName());
 
         quitEvent = true;
         buttonHold.restart();
@@ -323,7 +410,7 @@ void JoyButton::updateParamsAfterDistEvent()
     }
 }
 
-void JoyButton::startSequenceOfPressActive(bool isTurbo, QString debugText)
+void JoyButton::startSequenceOfPressActive(bool isTurbo, const char *debugText)
 {
     if (cycleResetActive && (cycleResetHold.elapsed() >= cycleResetInterval) && (slotiter != nullptr))
     {
@@ -348,7 +435,7 @@ void JoyButton::startSequenceOfPressActive(bool isTurbo, QString debugText)
     currentAccelerationDistance = getAccelerationDistance();
 
     Q_ASSERT(!m_parentSet.isNull());
-    qDebug() << debugText.arg(m_parentSet->getInputDevice()->getRealJoyNumber()).arg(getPartialName());
+    TRACE() << QString(debugText).arg(m_parentSet->getInputDevice()->getRealJoyNumber()).arg(getPartialName());
 }
 
 /**
@@ -461,7 +548,7 @@ bool JoyButton::distanceEvent()
 
             if (previousCycle != nullptr)
             {
-                qDebug() << "find previous Cycle in next steps in assignments and skip to it";
+                TRACE() << "find previous Cycle in next steps in assignments and skip to it";
 
                 iter.findNext(previousCycle);
             }
@@ -525,13 +612,13 @@ bool JoyButton::distanceEvent()
                     releaseActiveSlots();
                     currentPause = currentHold = nullptr;
 
-                    qDebug() << "Deactive slots in previous range and activate new slots";
+                    TRACE() << "Deactive slots in previous range and activate new slots";
 
                     slotiter->toFront();
 
                     if (previousCycle != nullptr)
                     {
-                        qDebug() << "Find previous Cycle in slotiter starting from beginning";
+                        TRACE() << "Find previous Cycle in slotiter starting from beginning";
 
                         slotiter->findNext(previousCycle);
                     }
@@ -600,7 +687,7 @@ void JoyButton::activateSlots()
 
             if (slot->getSlotMode() == JoyButtonSlot::JoyMix)
             {
-                qDebug() << "JOYMIX IN ACTIVATESLOTS";
+                TRACE() << "JOYMIX IN ACTIVATESLOTS";
 
                 if (slot->getMixSlots() != nullptr)
                 {
@@ -616,8 +703,8 @@ void JoyButton::activateSlots()
                     while (it->hasNext())
                     {
                         JoyButtonSlot *slotmini = it->next();
-                        qDebug() << "Run activated mini slot - name - deviceCode - mode: " << slotmini->getSlotString()
-                                 << " - " << slotmini->getSlotCode() << " - " << slotmini->getSlotMode();
+                        TRACE() << "Run activated mini slot - name - deviceCode - mode: " << slotmini->getSlotString()
+                                << " - " << slotmini->getSlotCode() << " - " << slotmini->getSlotMode();
 
                         MiniSlotRun *minijob = new MiniSlotRun(slot, slotmini, this, timeBetweenMiniSlots * timeX);
 
@@ -647,7 +734,7 @@ void JoyButton::activateSlots()
                 }
             } else
             {
-                qDebug() << "Check now simple slots";
+                TRACE() << "Check now simple slots";
                 addEachSlotToActives(slot, i, delaySequence, exit, slotiter);
             }
         }
@@ -675,12 +762,12 @@ void JoyButton::activateMiniSlots(JoyButtonSlot *slot, JoyButtonSlot *mix)
 
         if (!slot->isModifierKey())
         {
-            qDebug() << "There has been assigned a lastActiveKey " << slot->getSlotString();
+            TRACE() << "There has been assigned a lastActiveKey " << slot->getSlotString();
 
             lastActiveKey = mix;
         } else
         {
-            qDebug() << "It's not modifier key. lastActiveKey is null pointer";
+            TRACE() << "It's not modifier key. lastActiveKey is null pointer";
 
             lastActiveKey = nullptr;
         }
@@ -698,7 +785,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyKeyboard: {
         i++;
 
-        qDebug() << i << ": It's a JoyKeyboard with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyKeyboard with code: " << tempcode << " and name: " << slot->getSlotString();
 
         sendevent(slot, true);
 
@@ -708,12 +795,12 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
 
         if (!slot->isModifierKey())
         {
-            qDebug() << "There has been assigned a lastActiveKey " << slot->getSlotString();
+            TRACE() << "There has been assigned a lastActiveKey " << slot->getSlotString();
 
             lastActiveKey = slot;
         } else
         {
-            qDebug() << "It's not modifier key. lastActiveKey is null pointer";
+            TRACE() << "It's not modifier key. lastActiveKey is null pointer";
 
             lastActiveKey = nullptr;
         }
@@ -723,7 +810,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyMouseButton: {
         i++;
 
-        qDebug() << i << ": It's a JoyMouseButton with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyMouseButton with code: " << tempcode << " and name: " << slot->getSlotString();
 
         if ((tempcode == static_cast<int>(JoyButtonSlot::MouseWheelUp)) ||
             (tempcode == static_cast<int>(JoyButtonSlot::MouseWheelDown)))
@@ -756,7 +843,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyMouseMovement: {
         i++;
 
-        qDebug() << i << ": It's a JoyMouseMovement with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyMouseMovement with code: " << tempcode << " and name: " << slot->getSlotString();
 
         slot->getMouseInterval()->restart();
 
@@ -770,18 +857,16 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
 
         // Temporarily lower timer interval. Helps improve mouse control
         // precision on the lower end of an axis.
-        if (!staticMouseEventTimer.isActive() || (staticMouseEventTimer.interval() != 0))
+        if (!staticMouseEventTimer.isActive() ||
+            (staticMouseEventTimer.intervalUsec() == staticMouseEventTimer.idleIntervalUsec()))
         {
-            if (!staticMouseEventTimer.isActive() ||
-                (staticMouseEventTimer.interval() == GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE))
-            {
-                int tempRate =
-                    qBound(0, GlobalVariables::JoyButton::mouseRefreshRate - GlobalVariables::JoyButton::gamepadRefreshRate,
-                           GlobalVariables::JoyButton::MAXIMUMMOUSEREFRESHRATE);
-                staticMouseEventTimer.start(tempRate);
-                testOldMouseTime.restart();
-                accelExtraDurationTime.restart();
-            }
+            int tempPeriod = qBound(0,
+                                    GlobalVariables::JoyButton::mouseRefreshPeriodUsec -
+                                        (GlobalVariables::JoyButton::gamepadRefreshRate * 1000),
+                                    GlobalVariables::JoyButton::MAXIMUMMOUSEREFRESHRATE * 1000);
+            staticMouseEventTimer.startBurst(tempPeriod);
+            testOldMouseTime.restart();
+            accelExtraDurationTime.restart();
         }
 
         break;
@@ -789,11 +874,11 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyPause: {
         i++;
 
-        qDebug() << i << ": It's a JoyPause with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyPause with code: " << tempcode << " and name: " << slot->getSlotString();
 
         if (!getActiveSlots().isEmpty())
         {
-            qDebug() << "active slots QHash is not empty";
+            TRACE() << "active slots QHash is not empty";
 
             if (slotiter->hasPrevious())
             {
@@ -808,7 +893,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
         // Segment can be ignored on a 0 interval pause
         else if (tempcode > 0)
         {
-            qDebug() << "active slots QHash is empty";
+            TRACE() << "active slots QHash is empty";
 
             currentPause = slot;
             pauseHold.restart();
@@ -822,7 +907,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyHold: {
         i++;
 
-        qDebug() << i << ": It's a JoyHold with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyHold with code: " << tempcode << " and name: " << slot->getSlotString();
 
         currentHold = slot;
         holdTimer.start(0);
@@ -832,7 +917,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyDelay: {
         i++;
 
-        qDebug() << i << ": It's a JoyDelay with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyDelay with code: " << tempcode << " and name: " << slot->getSlotString();
 
         currentDelay = slot;
         buttonDelay.restart();
@@ -843,7 +928,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyCycle: {
         i++;
 
-        qDebug() << i << ": It's a JoyCycle with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyCycle with code: " << tempcode << " and name: " << slot->getSlotString();
 
         currentCycle = slot;
         exit = true;
@@ -852,7 +937,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyDistance: {
         i++;
 
-        qDebug() << i << ": It's a JoyDistance with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyDistance with code: " << tempcode << " and name: " << slot->getSlotString();
 
         exit = true;
         break;
@@ -860,23 +945,23 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyRelease: {
         i++;
 
-        qDebug() << i << ": It's a JoyRelease with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyRelease with code: " << tempcode << " and name: " << slot->getSlotString();
 
         if (currentRelease == nullptr)
         {
             findJoySlotsEnd(slotiter);
         } else if ((currentRelease != nullptr) && getActiveSlots().isEmpty())
         {
-            qDebug() << "current is release but activeSlots is empty";
+            TRACE() << "current is release but activeSlots is empty";
 
             exit = true;
         } else if ((currentRelease != nullptr) && !getActiveSlots().isEmpty())
         {
-            qDebug() << "current is release and activeSlots is not empty";
+            TRACE() << "current is release and activeSlots is not empty";
 
             if (slotiter->hasPrevious())
             {
-                qDebug() << "Back to previous slotiter from release";
+                TRACE() << "Back to previous slotiter from release";
 
                 i--;
                 slotiter->previous();
@@ -891,7 +976,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyMouseSpeedMod: {
         i++;
 
-        qDebug() << i << ": It's a JoyMouseSpeedMod with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyMouseSpeedMod with code: " << tempcode << " and name: " << slot->getSlotString();
 
         GlobalVariables::JoyButton::mouseSpeedModifier = tempcode * 0.01;
         mouseSpeedModList.append(slot);
@@ -902,21 +987,21 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyKeyPress: {
         i++;
 
-        qDebug() << i << ": It's a JoyKeyPress with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyKeyPress with code: " << tempcode << " and name: " << slot->getSlotString();
 
         if (getActiveSlots().isEmpty())
         {
-            qDebug() << "activeSlots is empty. It's a true delaySequence and assigned currentKeyPress";
+            TRACE() << "activeSlots is empty. It's a true delaySequence and assigned currentKeyPress";
 
             delaySequence = true;
             currentKeyPress = slot;
         } else
         {
-            qDebug() << "activeSlots is not empty. It's a true delaySequence and exit";
+            TRACE() << "activeSlots is not empty. It's a true delaySequence and exit";
 
             if (slotiter->hasPrevious())
             {
-                qDebug() << "Back to previous slotiter from JoyKeyPress";
+                TRACE() << "Back to previous slotiter from JoyKeyPress";
 
                 i--;
                 slotiter->previous();
@@ -931,7 +1016,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyLoadProfile: {
         i++;
 
-        qDebug() << i << ": It's a JoyLoadProfile with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyLoadProfile with code: " << tempcode << " and name: " << slot->getSlotString();
 
         releaseActiveSlots();
         slotiter->toBack();
@@ -947,7 +1032,7 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoySetChange: {
         i++;
 
-        qDebug() << i << ": It's a JoySetChange with code: " << tempcode << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoySetChange with code: " << tempcode << " and name: " << slot->getSlotString();
 
         getActiveSlotsLocal().append(slot);
 
@@ -957,8 +1042,8 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
     case JoyButtonSlot::JoyExecute: {
         i++;
 
-        qDebug() << i << ": It's a JoyExecute or JoyTextEntry with code: " << tempcode
-                 << " and name: " << slot->getSlotString();
+        TRACE() << i << ": It's a JoyExecute or JoyTextEntry with code: " << tempcode
+                << " and name: " << slot->getSlotString();
 
         sendevent(slot, true);
 
@@ -1010,13 +1095,15 @@ void JoyButton::mouseEvent()
         if (buttonslot == nullptr)
             buttonslot = mouseEventQueue.dequeue();
 
-        int timeElapsed = testOldMouseTime.elapsed();
+        // Elapsed time in ms. Keep the fraction for sub-millisecond refresh periods.
+        double timeElapsed = testOldMouseTime.nsecsElapsed() * 0.000001;
+        int intervalUsec = staticMouseEventTimer.intervalUsec();
 
         // Presumed initial mouse movement. Use full duration rather than
         // partial.
-        if (staticMouseEventTimer.interval() < GlobalVariables::JoyButton::mouseRefreshRate)
+        if (intervalUsec < GlobalVariables::JoyButton::mouseRefreshPeriodUsec)
         {
-            timeElapsed = GlobalVariables::JoyButton::mouseRefreshRate + (timeElapsed - staticMouseEventTimer.interval());
+            timeElapsed += (GlobalVariables::JoyButton::mouseRefreshPeriodUsec - intervalUsec) * 0.001;
         }
 
         while (buttonslot != nullptr)
@@ -1053,51 +1140,10 @@ void JoyButton::mouseEvent()
                     double sumDist = buttonslot->getMouseDistance();
                     JoyMouseCurve currentCurve = getMouseCurve();
 
+                    const JoyMouseCurveResponse *curveResponse = m_mouse_curve_response.loadAcquire();
+
                     switch (currentCurve)
                     {
-                    case QuadraticCurve: {
-                        difference = difference * difference;
-                        break;
-                    }
-                    case CubicCurve: {
-                        difference = difference * difference * difference;
-                        break;
-                    }
-                    case QuadraticExtremeCurve: {
-                        double temp = difference;
-                        difference = difference * difference;
-                        difference = (temp >= 0.95) ? (difference * 1.5) : difference;
-                        break;
-                    }
-                    case PowerCurve: {
-                        double tempsensitive = qMin(qMax(sensitivity, 1.0e-3), 1.0e+3);
-                        double temp = qMin(qMax(pow(difference, 1.0 / tempsensitive), 0.0), 1.0);
-                        difference = temp;
-                        break;
-                    }
-                    case EnhancedPrecisionCurve: {
-                        // Perform different forms of acceleration depending on
-                        // the range of the element from its assigned dead zone.
-                        // Useful for more precise controls with an axis.
-                        double temp = difference;
-                        if (temp <= 0.4)
-                        {
-                            // Low slope value for really slow acceleration
-                            difference = (difference * 0.37);
-                        } else if (temp <= 0.75)
-                        {
-                            // Perform Linear accleration with an appropriate
-                            // offset.
-                            difference = (difference - 0.252);
-                        } else
-                        {
-                            // Perform mouse acceleration. Make up the difference
-                            // due to the previous two segments. Maxes out at 1.0.
-                            difference = (difference * 2.008) - 1.008;
-                        }
-
-                        break;
-                    }
                     case EasingQuadraticCurve:
                     case EasingCubicCurve: {
                         // Perform different forms of acceleration depending on
@@ -1165,6 +1211,11 @@ void JoyButton::mouseEvent()
                         break;
                     }
                     default:
+                        // The table is null for a short time while the GUI
+                        // switches away from an easing curve.
+                        if (curveResponse != nullptr)
+                            difference = curveResponse->map(difference);
+
                         break;
                     }
 
@@ -1228,8 +1279,8 @@ void JoyButton::mouseEvent()
                                (currentAccelMulti > 0.0) &&
                                (fabs(getAccelerationDistance() - startingAccelerationDistance) < minstop))
                     {
-                        qDebug() << "Keep Trying: " << fabs(getAccelerationDistance() - lastAccelerationDistance);
-                        qDebug() << "MIN TRAVEL: " << mintravel;
+                        TRACE() << "Keep Trying: " << fabs(getAccelerationDistance() - lastAccelerationDistance);
+                        TRACE() << "MIN TRAVEL: " << mintravel;
 
                         updateStartingMouseDistance = true;
                         double magfactor = extraAccelerationMultiplier;
@@ -1684,7 +1735,7 @@ QString JoyButton::getCalculatedActiveZoneSummary()
 void JoyButton::buildActiveZoneSummaryString()
 {
     lockForWritedString(activeZoneString, getActiveZoneSummary());
-    qDebug() << "activeZoneString after getActiveZoneSummary() is: " << activeZoneString;
+    TRACE() << "activeZoneString after getActiveZoneSummary() is: " << activeZoneString;
     emit activeZoneChanged();
 }
 
@@ -1737,13 +1788,13 @@ QString JoyButton::buildActiveZoneSummary(QList<JoyButtonSlot *> &tempList)
                 {
                     JoyButtonSlot *slotMini = iterM->next();
                     JoyButtonSlot::JoySlotInputAction modeMini = slotMini->getSlotMode();
-                    qDebug() << "modeMini is " << modeMini;
-                    qDebug() << "slotsActive are empty? " << slotsActive;
+                    TRACE() << "modeMini is " << modeMini;
+                    TRACE() << "slotsActive are empty? " << slotsActive;
                     buildActiveZoneSummarySwitchSlots(modeMini, slotMini, behindHold, &stringListMix, j, iterM, slotsActive);
 
                     stringListMix.append("+");
 
-                    qDebug() << "Create summary for JoyMix. Progress: " << stringListMix;
+                    TRACE() << "Create summary for JoyMix. Progress: " << stringListMix;
                 }
 
                 j = 0;
@@ -1754,7 +1805,7 @@ QString JoyButton::buildActiveZoneSummary(QList<JoyButtonSlot *> &tempList)
                     if (stringListMix.last() == '+')
                         stringListMix.removeLast();
 
-                    qDebug() << "Create summary for JoyMix. Progress: " << stringListMix;
+                    TRACE() << "Create summary for JoyMix. Progress: " << stringListMix;
 
                     QString res = "";
 
@@ -1789,9 +1840,9 @@ QString JoyButton::buildActiveZoneSummary(QList<JoyButtonSlot *> &tempList)
         newlabel.append(tr("[NO KEY]"));
     }
 
-    qDebug() << "NEW LABEL IS: " << newlabel;
-    qDebug() << "i: " << i;
-    qDebug() << "j: " << j;
+    TRACE() << "NEW LABEL IS: " << newlabel;
+    TRACE() << "i: " << i;
+    TRACE() << "j: " << j;
     return newlabel;
 }
 
@@ -1897,7 +1948,7 @@ QList<JoyButtonSlot *> JoyButton::getActiveZoneList()
     QListIterator<JoyButtonSlot *> *iter = nullptr;
     QReadWriteLock *tempLock = nullptr;
 
-    qDebug() << "Active slots are: ";
+    TRACE() << "Active slots are: ";
 
     int x, y;
     x = 0;
@@ -1905,14 +1956,14 @@ QList<JoyButtonSlot *> JoyButton::getActiveZoneList()
     for (auto actSlot : getActiveSlots())
     {
         x++;
-        qDebug() << x << ") " << actSlot->getSlotString();
+        TRACE() << x << ") " << actSlot->getSlotString();
     }
 
-    qDebug() << "Assigned slots are: ";
+    TRACE() << "Assigned slots are: ";
     for (auto assignedSlot : *getAssignedSlots())
     {
         y++;
-        qDebug() << y << ") " << assignedSlot->getSlotString();
+        TRACE() << y << ") " << assignedSlot->getSlotString();
     }
 
     activeZoneLock.lockForRead();
@@ -1936,7 +1987,7 @@ QList<JoyButtonSlot *> JoyButton::getActiveZoneList()
     {
         if (previousCycle != nullptr)
         {
-            qDebug() << "if there exists previous Cycle, find it in activeSlots";
+            TRACE() << "if there exists previous Cycle, find it in activeSlots";
 
             iter->findNext(previousCycle);
         }
@@ -1998,7 +2049,7 @@ QString JoyButton::getSlotsString()
 
     if (getAssignedSlots()->size() > 0)
     {
-        qDebug() << "There is more assignments than 0 in getSlotsString(): " << getAssignedSlots()->count();
+        TRACE() << "There is more assignments than 0 in getSlotsString(): " << getAssignedSlots()->count();
 
         QListIterator<JoyButtonSlot *> iter(*getAssignedSlots());
         QStringList stringlist = QStringList();
@@ -2006,13 +2057,13 @@ QString JoyButton::getSlotsString()
         while (iter.hasNext())
         {
             JoyButtonSlot *slot = iter.next();
-            qDebug() << "deviceCode = " << slot->getSlotCode();
-            qDebug() << "slotMode = " << slot->getSlotMode();
+            TRACE() << "deviceCode = " << slot->getSlotCode();
+            TRACE() << "slotMode = " << slot->getSlotMode();
             QString slotString = slot->getSlotString();
 
             if (slotString == tr("[NO KEY]"))
             {
-                qDebug() << "EMPTY ASSIGNED SLOT";
+                TRACE() << "EMPTY ASSIGNED SLOT";
             }
 
             stringlist.append(slotString); // tu
@@ -2021,7 +2072,7 @@ QString JoyButton::getSlotsString()
         label = stringlist.join(", ");
     } else
     {
-        qDebug() << "There is no assignments for button in getSlotsString()";
+        TRACE() << "There is no assignments for button in getSlotsString()";
 
         label = label.append(tr("[NO KEY]"));
     }
@@ -2216,7 +2267,7 @@ bool JoyButton::insertAssignedSlot(int code, int alias, int index, JoyButtonSlot
             getAssignmentsLocal().append(slot);
         }
 
-        qDebug() << "assignments variable in joybutton has now: " << getAssignedSlots()->count() << " input slots";
+        TRACE() << "assignments variable in joybutton has now: " << getAssignedSlots()->count() << " input slots";
 
         checkTurboCondition(slot);
         assignmentsLock.unlock();
@@ -2294,7 +2345,7 @@ bool JoyButton::insertAssignedSlot(JoyButtonSlot *newSlot, int index, bool updat
             getAssignmentsLocal().append(slot);
         }
 
-        qDebug() << "assignments variable in joybutton has now: " << getAssignedSlots()->count() << " input slots";
+        TRACE() << "assignments variable in joybutton has now: " << getAssignedSlots()->count() << " input slots";
 
         checkTurboCondition(slot);
         assignmentsLock.unlock();
@@ -2689,8 +2740,8 @@ void JoyButton::holdEvent()
         // Activate hold event
         if (currentlyPressed && (buttonHold.elapsed() > currentHold->getSlotCode()))
         {
-            qDebug() << buttonHold.elapsed() << " > " << currentHold->getSlotCode();
-            qDebug() << "Activate hold event";
+            TRACE() << buttonHold.elapsed() << " > " << currentHold->getSlotCode();
+            TRACE() << "Activate hold event";
 
             releaseActiveSlots();
             currentHold = nullptr;
@@ -2701,22 +2752,22 @@ void JoyButton::holdEvent()
         // Elapsed time has not occurred
         else if (currentlyPressed)
         {
-            qDebug() << "Elapsed time has not occurred, because buttonHold: " << buttonHold.elapsed()
-                     << " is not greater than currentHoldCode: " << currentHold->getSlotCode();
+            TRACE() << "Elapsed time has not occurred, because buttonHold: " << buttonHold.elapsed()
+                    << " is not greater than currentHoldCode: " << currentHold->getSlotCode();
 
             startTimerOverrun(currentHold->getSlotCode(), &buttonHold, &holdTimer);
         }
         // Pre-emptive release
         else
         {
-            qDebug() << "Hold button is not pressed";
+            TRACE() << "Hold button is not pressed";
 
             currentHold = nullptr;
             holdTimer.stop();
 
             if (slotiter != nullptr)
             {
-                qDebug() << "slotiter exists";
+                TRACE() << "slotiter exists";
 
                 findJoySlotsEnd(slotiter);
                 createDeskEvent();
@@ -2728,7 +2779,7 @@ void JoyButton::holdEvent()
     }
 }
 
-void JoyButton::startTimerOverrun(int slotCode, QElapsedTimer *currSlotTime, QTimer *currSlotTimer, bool releasedDeskTimer)
+void JoyButton::startTimerOverrun(int slotCode, QElapsedTimer *currSlotTime, InputTimer *currSlotTimer, bool releasedDeskTimer)
 {
     int proposedInterval = slotCode - currSlotTime->elapsed();
     proposedInterval = (proposedInterval > 0) ? proposedInterval : 0;
@@ -2826,7 +2877,7 @@ void JoyButton::releaseDeskEvent(bool skipsetchange)
         {
             // At the end of the list of assignments.
 
-            qDebug() << "There is end of slotiter. Set currentCycle and previousCycle as null pointers";
+            TRACE() << "There is end of slotiter. Set currentCycle and previousCycle as null pointers";
 
             currentCycle = nullptr;
             previousCycle = nullptr;
@@ -2834,7 +2885,7 @@ void JoyButton::releaseDeskEvent(bool skipsetchange)
         } else if ((slotiter != nullptr) && slotiter->hasNext() && (currentCycle != nullptr))
         {
             // Cycle at the end of a segment.
-            qDebug() << "There exists next element in slotiter and exists currentCycle. Skip to currentCycle in slotiter "
+            TRACE() << "There exists next element in slotiter and exists currentCycle. Skip to currentCycle in slotiter "
                         "starting from beginning";
 
             slotiter->toFront();
@@ -2845,7 +2896,7 @@ void JoyButton::releaseDeskEvent(bool skipsetchange)
             // current slot. Useful after dealing with pause
             // actions.
 
-            qDebug() << "There exists next element and previous element in slotiter but doesn't exists currentCycle. From "
+            TRACE() << "There exists next element and previous element in slotiter but doesn't exists currentCycle. From "
                         "current point in slotiter find JoyButtonSlot::JoyCycle as slotMode and assign to currentCycle";
 
             JoyButtonSlot *tempslot = nullptr;
@@ -2866,7 +2917,7 @@ void JoyButton::releaseDeskEvent(bool skipsetchange)
             // to the front.
             if (currentCycle == nullptr)
             {
-                qDebug() << "Didn't find any cycle. Back to start of slotiter";
+                TRACE() << "Didn't find any cycle. Back to start of slotiter";
 
                 slotiter->toFront();
                 previousCycle = nullptr;
@@ -2875,13 +2926,13 @@ void JoyButton::releaseDeskEvent(bool skipsetchange)
 
         if (currentCycle != nullptr)
         {
-            qDebug() << "currentCycle exists and previousCycle will be current but current will be null pointer";
+            TRACE() << "currentCycle exists and previousCycle will be current but current will be null pointer";
 
             previousCycle = currentCycle;
             currentCycle = nullptr;
         } else if ((slotiter != nullptr) && slotiter->hasNext() && containsReleaseSlots())
         {
-            qDebug() << "Slotiter has next element on the list. In assignments exists JoyButtonSlot::JoyRelease starting "
+            TRACE() << "Slotiter has next element on the list. In assignments exists JoyButtonSlot::JoyRelease starting "
                         "from current point. CurrentCycle and previousCycle are set null pointers now";
 
             currentCycle = nullptr;
@@ -3001,9 +3052,9 @@ void JoyButton::clearAssignedSlots(bool signalEmit)
     {
         auto *slot = iter.next();
 
-        qDebug() << "AssignedSLot mode: " << slot->getSlotMode();
-        qDebug() << "cleared assigned slot's mode: " << slot->getSlotMode();
-        qDebug() << "list of mix slots is a null pointer? " << ((slot->getMixSlots() == nullptr) ? "yes" : "no");
+        TRACE() << "AssignedSLot mode: " << slot->getSlotMode();
+        TRACE() << "cleared assigned slot's mode: " << slot->getSlotMode();
+        TRACE() << "list of mix slots is a null pointer? " << ((slot->getMixSlots() == nullptr) ? "yes" : "no");
 
         if (slot != nullptr)
         {
@@ -3027,13 +3078,13 @@ void JoyButton::removeAssignedSlot(int index)
     QWriteLocker tempAssignLocker(&assignmentsLock);
 
     int j = 0;
-    qDebug() << "Assigned list slots after joining";
+    TRACE() << "Assigned list slots after joining";
     for (auto el : *getAssignedSlots())
     {
-        qDebug() << j << ")";
-        qDebug() << "code: " << el->getSlotCode();
-        qDebug() << "mode: " << el->getSlotMode();
-        qDebug() << "string: " << el->getSlotString();
+        TRACE() << j << ")";
+        TRACE() << "code: " << el->getSlotCode();
+        TRACE() << "mode: " << el->getSlotMode();
+        TRACE() << "string: " << el->getSlotString();
         j++;
     }
 
@@ -3087,7 +3138,7 @@ void JoyButton::eventReset()
     stopTimers(false);
     clearQueues();
 
-    qDebug() << "all current slots and previous slots ale cleared";
+    TRACE() << "all current slots and previous slots ale cleared";
 
     releaseActiveSlots();
 }
@@ -3345,6 +3396,23 @@ bool JoyButton::containsReleaseSlots()
     return result;
 }
 
+bool JoyButton::containsSetChangeSlots()
+{
+    bool result = false;
+    QListIterator<JoyButtonSlot *> iter(*getAssignedSlots());
+
+    while (iter.hasNext())
+    {
+        if (iter.next()->getSlotMode() == JoyButtonSlot::JoySetChange)
+        {
+            result = true;
+            iter.toBack();
+        }
+    }
+
+    return result;
+}
+
 bool JoyButton::containsJoyMixSlot()
 {
     bool result = false;
@@ -3428,7 +3496,7 @@ void JoyButton::findJoySlotsEnd(QListIterator<JoyButtonSlot *> *slotiter)
         bool found = false;
         while (!found && slotiter->hasNext())
         {
-            qDebug() << "slotiter has next element";
+            TRACE() << "slotiter has next element";
 
             JoyButtonSlot::JoySlotInputAction mode = slotiter->next()->getSlotMode();
 
@@ -3531,6 +3599,7 @@ JoyButton::JoyMouseMovementMode JoyButton::getMouseMode() { return mouseMode; }
 void JoyButton::setMouseCurve(JoyMouseCurve selectedCurve)
 {
     mouseCurve = selectedCurve;
+    updateMouseCurveResponse();
     emit propertyUpdated();
 }
 
@@ -3563,6 +3632,7 @@ void JoyButton::setSensitivity(double value)
     if ((value >= 0.001) && (value <= 1000))
     {
         sensitivity = value;
+        updateMouseCurveResponse();
         emit propertyUpdated();
     }
 }
@@ -3621,26 +3691,21 @@ QString JoyButton::getDefaultButtonName() { return defaultButtonName; }
  * @brief Take cursor mouse information provided by all buttons and
  *     send a cursor mode mouse event to the display server.
  */
-void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QList<double> *mouseHistoryX,
-                                QList<double> *mouseHistoryY, QElapsedTimer *testOldMouseTime, QTimer *staticMouseEventTimer,
-                                int mouseRefreshRate, int mouseHistorySize, QList<JoyButton::mouseCursorInfo> *cursorXSpeeds,
+void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, MouseSmoothingHistory *mouseHistory,
+                                QElapsedTimer *testOldMouseTime, MouseEventScheduler *staticMouseEventTimer,
+                                int mouseRefreshPeriodUsec, QList<JoyButton::mouseCursorInfo> *cursorXSpeeds,
                                 QList<JoyButton::mouseCursorInfo> *cursorYSpeeds, double &cursorRemainderX,
-                                double &cursorRemainderY, double weightModifier, int idleMouseRefrRate,
-                                QList<JoyButton *> *pendingMouseButtons)
+                                double &cursorRemainderY, QList<JoyButton *> *pendingMouseButtons)
 {
     movedX = 0;
     movedY = 0;
-    int elapsedTime = testOldMouseTime->elapsed();
-    movedElapsed = elapsedTime;
-
-    if (staticMouseEventTimer->interval() < mouseRefreshRate)
-        movedElapsed = mouseRefreshRate + (elapsedTime - staticMouseEventTimer->interval());
+    qint64 elapsedUsec = testOldMouseTime->nsecsElapsed() / 1000;
+    int intervalUsec = staticMouseEventTimer->intervalUsec();
 
-    if (mouseHistoryX->size() >= mouseHistorySize)
-        mouseHistoryX->removeLast();
+    if (intervalUsec < mouseRefreshPeriodUsec)
+        elapsedUsec += mouseRefreshPeriodUsec - intervalUsec;
 
-    if (mouseHistoryY->size() >= mouseHistorySize)
-        mouseHistoryY->removeLast();
+    movedElapsed = static_cast<int>(elapsedUsec / 1000);
 
     /*
      * Combine all mouse events to find the distance to move the mouse
@@ -3675,8 +3740,6 @@ void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QLi
         if (abs(finalx) > 127)
             finalx = (finalx < 0) ? -127 : 127;
 
-        mouseHistoryX->prepend(finalx);
-
         // Only apply remainder if both current displacement and remainder
         // follow the same direction.
         if ((cursorRemainderY >= 0) == (finaly >= 0))
@@ -3686,15 +3749,16 @@ void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QLi
         if (abs(finaly) > 127)
             finaly = (finaly < 0) ? -127 : 127;
 
-        mouseHistoryY->prepend(finaly);
+        mouseHistory->push(finalx, finaly);
 
         cursorRemainderX = 0;
         cursorRemainderY = 0;
         double adjustedX = 0;
         double adjustedY = 0;
 
-        adjustAxForCursor(mouseHistoryX, adjustedX, cursorRemainderX, weightModifier);
-        adjustAxForCursor(mouseHistoryY, adjustedY, cursorRemainderY, weightModifier);
+        mouseHistory->weightedAverage(adjustedX, adjustedY);
+        adjustAxForCursor(adjustedX, cursorRemainderX);
+        adjustAxForCursor(adjustedY, cursorRemainderY);
 
         // This check is more of a precaution than anything. No need to cause
         // a sync to happen when not needed.
@@ -3705,35 +3769,23 @@ void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QLi
         movedY = adjustedY;
     } else
     {
-        mouseHistoryX->prepend(0);
-        mouseHistoryY->prepend(0);
+        mouseHistory->push(0.0, 0.0);
     }
 
     // Check if mouse event timer should use idle time.
-    if (pendingMouseButtons->length() == 0)
+    bool idle = pendingMouseButtons->isEmpty();
+    bool periodChanged = staticMouseEventTimer->setIdle(idle);
+
+    if (idle)
     {
-        if (staticMouseEventTimer->interval() != idleMouseRefrRate)
+        if (periodChanged)
         {
-            staticMouseEventTimer->start(idleMouseRefrRate);
-
-            // Clear current mouse history
-            mouseHistoryX->clear();
-            mouseHistoryY->clear();
-
-            // Fill history with zeroes.
-            for (int i = 0; i < mouseHistorySize; i++)
-            {
-                mouseHistoryX->append(0);
-                mouseHistoryY->append(0);
-            }
+            // Clear current mouse history and fill it with zeroes.
+            mouseHistory->fillZero();
         }
 
         cursorRemainderX = 0;
         cursorRemainderY = 0;
-    } else
-    {
-        if (staticMouseEventTimer->interval() != mouseRefreshRate)
-            staticMouseEventTimer->start(mouseRefreshRate); // Restore intended QTimer interval.
     }
 
     cursorXSpeeds->clear();
@@ -3751,23 +3803,15 @@ void JoyButton::distanceForMovingAx(double &finalAx, mouseCursorInfo infoAx)
         finalAx += infoAx.code;
 }
 
-void JoyButton::adjustAxForCursor(QList<double> *mouseHistoryList, double &adjustedAx, double &cursorRemainder,
-                                  double weightModifier)
+/**
+ * @brief Truncates a smoothed mouse distance to whole pixels.
+ * @param[in,out] adjustedAx Smoothed mouse distance. Updated by this function.
+ * @param[out] cursorRemainder Fractional part to carry over to the next event.
+ */
+void JoyButton::adjustAxForCursor(double &adjustedAx, double &cursorRemainder)
 {
-    double currentWeight = 1.0;
-    double finalWeight = 0.0;
-
-    QListIterator<double> mouseHist(*mouseHistoryList);
-    while (mouseHist.hasNext())
-    {
-        adjustedAx += mouseHist.next() * currentWeight;
-        finalWeight += currentWeight;
-        currentWeight *= weightModifier;
-    }
-
     if (fabs(adjustedAx) > 0)
     {
-        adjustedAx = adjustedAx / finalWeight;
         double oldAx = adjustedAx;
 
         if (adjustedAx > 0)
@@ -3786,7 +3830,7 @@ void JoyButton::adjustAxForCursor(QList<double> *mouseHistoryList, double &adjus
 void JoyButton::moveSpringMouse(int &movedX, int &movedY, bool &hasMoved, int springModeScreen,
                                 QList<PadderCommon::springModeInfo> *springXSpeeds,
                                 QList<PadderCommon::springModeInfo> *springYSpeeds, QList<JoyButton *> *pendingMouseButtons,
-                                int mouseRefreshRate, int idleMouseRefrRate, QTimer *staticMouseEventTimer)
+                                MouseEventScheduler *staticMouseEventTimer)
 {
     PadderCommon::springModeInfo fullSpring = {-2.0, -2.0, 0, 0, false, springModeScreen, 0.0, 0.0};
 
@@ -3902,15 +3946,7 @@ void JoyButton::moveSpringMouse(int &movedX, int &movedY, bool &hasMoved, int sp
     }
 
     // Check if mouse event timer should use idle time.
-    if (pendingMouseButtons->length() == 0)
-    {
-        staticMouseEventTimer->start(idleMouseRefrRate);
-    } else
-    {
-        if (staticMouseEventTimer->interval() != mouseRefreshRate)
-            // Restore intended QTimer interval.
-            staticMouseEventTimer->start(mouseRefreshRate);
-    }
+    staticMouseEventTimer->setIdle(pendingMouseButtons->isEmpty());
 
     springXSpeeds->clear();
     springYSpeeds->clear();
@@ -4051,14 +4087,12 @@ void JoyButton::disconnectPropertyUpdatedConnections()
  */
 void JoyButton::establishMouseTimerConnections()
 {
-    if (staticMouseEventTimer.timerType() != Qt::PreciseTimer)
-        staticMouseEventTimer.setTimerType(Qt::PreciseTimer);
-
     // Only one connection will be made for each.
-    connect(&staticMouseEventTimer, &QTimer::timeout, &mouseHelper, &JoyButtonMouseHelper::mouseEvent, Qt::UniqueConnection);
+    connect(&staticMouseEventTimer, &MouseEventScheduler::timeout, &mouseHelper, &JoyButtonMouseHelper::mouseEvent,
+            Qt::UniqueConnection);
 
-    if (staticMouseEventTimer.interval() != GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE)
-        staticMouseEventTimer.setInterval(GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE);
+    staticMouseEventTimer.setIdleIntervalUsec(GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE * 1000);
+    staticMouseEventTimer.setActiveIntervalUsec(GlobalVariables::JoyButton::mouseRefreshPeriodUsec);
 }
 
 void JoyButton::setSpringRelativeStatus(bool value)
@@ -4111,6 +4145,7 @@ void JoyButton::copyAssignments(JoyButton *destButton)
     destButton->springWidth = springWidth;
     destButton->springHeight = springHeight;
     destButton->sensitivity = sensitivity;
+    destButton->updateMouseCurveResponse();
     destButton->buttonName = buttonName;
     destButton->actionName = actionName;
     destButton->cycleResetActive = cycleResetActive;
@@ -4152,6 +4187,75 @@ JoyButton::TurboMode JoyButton::getTurboMode() { return currentTurboMode; }
  */
 bool JoyButton::isPartRealAxis() { return false; }
 
+/**
+ * @brief Selects the precalculated table of the assigned mouse curve.
+ *  Easing curves depend on how long the button is held and have no table.
+ */
+void JoyButton::updateMouseCurveResponse()
+{
+    JoyMouseCurveResponse::Function function = mouseCurveFunction(mouseCurve);
+    const JoyMouseCurveResponse *response = nullptr;
+
+    if (function != nullptr)
+        response = JoyMouseCurveResponse::get(mouseCurve, mouseCurveParameter(mouseCurve, sensitivity), function);
+
+    m_mouse_curve_response.storeRelease(response);
+}
+
+/**
+ * @brief Compares the time it takes to calculate each mouse curve with the
+ *  time it takes to look it up in its table and prints the result.
+ * @returns Exit code for the command line.
+ */
+int JoyButton::benchmarkMouseCurves(int iterations)
+{
+    const QList<QPair<JoyMouseCurve, const char *>> curves = {
+        {LinearCurve, "Linear"},
+        {QuadraticCurve, "Quadratic"},
+        {CubicCurve, "Cubic"},
+        {QuadraticExtremeCurve, "Quadratic Extreme"},
+        {PowerCurve, "Power"},
+        {EnhancedPrecisionCurve, "Enhanced Precision"}};
+
+    // Step through the distances with a stride that does not match the table.
+    auto distance = [](int i) { return static_cast<double>(i % 1009) / 1008; };
+
+    QVector<double> calculated(iterations);
+    QVector<double> lookedUp(iterations);
+    QElapsedTimer timer;
+
+    PRINT_STDOUT() << "Mouse curves, average of " << iterations << " evaluations\n";
+
+    for (const QPair<JoyMouseCurve, const char *> &curve : curves)
+    {
+        JoyMouseCurveResponse::Function function = mouseCurveFunction(curve.first);
+        double parameter = mouseCurveParameter(curve.first, GlobalVariables::JoyButton::DEFAULTSENSITIVITY);
+        const JoyMouseCurveResponse *response = JoyMouseCurveResponse::get(curve.first, parameter, function);
+
+        timer.start();
+
+        for (int i = 0; i < iterations; i++)
+            calculated[i] = function(distance(i), parameter);
+
+        qint64 calculateTime = timer.nsecsElapsed();
+        timer.restart();
+
+        for (int i = 0; i < iterations; i++)
+            lookedUp[i] = response->map(distance(i));
+
+        qint64 lookUpTime = timer.nsecsElapsed();
+        double maxDifference = 0.0;
+
+        for (int i = 0; i < iterations; i++)
+            maxDifference = qMax(maxDifference, qAbs(calculated.at(i) - lookedUp.at(i)));
+
+        PRINT_STDOUT() << curve.second << ": calculated " << calculateTime / iterations << " ns, table "
+                       << lookUpTime / iterations << " ns, max. difference " << maxDifference << "\n";
+    }
+
+    return 0;
+}
+
 /**
  * @brief Calculate maximum mouse speed when using a given mouse curve.
  * @param Mouse curve
@@ -4206,7 +4310,7 @@ QList<PadderCommon::springModeInfo> *JoyButton::getSpringXSpeeds() { return &spr
 
 QList<PadderCommon::springModeInfo> *JoyButton::getSpringYSpeeds() { return &springYSpeeds; }
 
-QTimer *JoyButton::getStaticMouseEventTimer() { return &staticMouseEventTimer; }
+MouseEventScheduler *JoyButton::getStaticMouseEventTimer() { return &staticMouseEventTimer; }
 
 QElapsedTimer *JoyButton::getTestOldMouseTime() { return &testOldMouseTime; }
 
@@ -4228,61 +4332,54 @@ bool JoyButton::hasSpringEvents(QList<PadderCommon::springModeInfo> *springXSpee
  * @brief Set the weight modifier to use for mouse smoothing.
  * @param Weight modifier in the range of 0.0 - 1.0.
  */
-void JoyButton::setWeightModifier(double modifier, double maxWeightModifier, double &weightModifier)
+void JoyButton::setWeightModifier(double modifier, double maxWeightModifier, double &weightModifier,
+                                  MouseSmoothingHistory *mouseHistory)
 {
     if ((modifier >= 0.0) && (modifier <= maxWeightModifier))
+    {
         weightModifier = modifier;
+        mouseHistory->setWeightModifier(modifier);
+    }
 }
 
 /**
  * @brief Set mouse history buffer size used for mouse smoothing.
  * @param Mouse history buffer size
  */
-void JoyButton::setMouseHistorySize(int size, int maxMouseHistSize, int &mouseHistSize, QList<double> *mouseHistoryX,
-                                    QList<double> *mouseHistoryY)
+void JoyButton::setMouseHistorySize(int size, int maxMouseHistSize, int &mouseHistSize,
+                                    MouseSmoothingHistory *mouseHistory)
 {
     if ((size >= 1) && (size <= maxMouseHistSize))
     {
-        mouseHistoryX->clear();
-        mouseHistoryY->clear();
+        mouseHistory->setCapacity(size);
         mouseHistSize = size;
     }
 }
 
 /**
- * @brief Set the mouse refresh rate when a mouse slot is active.
- * @param Refresh rate in ms.
+ * @brief Set the mouse refresh period when a mouse slot is active.
+ * @param Refresh period in us. Periods below 1 ms are allowed.
  */
-void JoyButton::setMouseRefreshRate(int refresh, int &mouseRefreshRate, int idleMouseRefrRate,
-                                    JoyButtonMouseHelper *mouseHelper, QList<double> *mouseHistoryX,
-                                    QList<double> *mouseHistoryY, QElapsedTimer *testOldMouseTime,
-                                    QTimer *staticMouseEventTimer)
+void JoyButton::setMouseRefreshPeriod(int periodUsec, int &mouseRefreshRate, int &mouseRefreshPeriodUsec,
+                                      JoyButtonMouseHelper *mouseHelper, MouseSmoothingHistory *mouseHistory,
+                                      QElapsedTimer *testOldMouseTime, MouseEventScheduler *staticMouseEventTimer)
 {
-    if ((refresh >= 1) && (refresh <= 16))
+    if ((periodUsec >= GlobalVariables::JoyButton::MINIMUMMOUSEREFRESHPERIODUSEC) &&
+        (periodUsec <= GlobalVariables::JoyButton::MAXIMUMMOUSEREFRESHRATE * 1000))
     {
-        mouseRefreshRate = refresh;
+        mouseRefreshPeriodUsec = periodUsec;
+        // Whole ms rate is still used by timers which can not go below 1 ms.
+        mouseRefreshRate = qMax(1, (periodUsec + 999) / 1000);
 
         if (staticMouseEventTimer->isActive())
         {
             testOldMouseTime->restart();
 
-            if (staticMouseEventTimer->interval() != idleMouseRefrRate && staticMouseEventTimer->interval() != 0)
-            {
-                QMetaObject::invokeMethod(staticMouseEventTimer, "start", Q_ARG(int, mouseRefreshRate));
-            } else
-            {
-                // Restart QTimer to keep QTimer in line with QTime
-                QMetaObject::invokeMethod(staticMouseEventTimer, "start", Q_ARG(int, idleMouseRefrRate));
-            }
-
             // Clear current mouse history
-            mouseHistoryX->clear();
-            mouseHistoryY->clear();
-        } else
-        {
-            staticMouseEventTimer->setInterval(idleMouseRefrRate);
+            mouseHistory->clear();
         }
 
+        staticMouseEventTimer->setActiveIntervalUsec(mouseRefreshPeriodUsec);
         mouseHelper->carryMouseRefreshRateUpdate(mouseRefreshRate);
     }
 }
@@ -4328,7 +4425,7 @@ void JoyButton::checkTurboCondition(JoyButtonSlot *slot)
 
 void JoyButton::resetProperties()
 {
-    qDebug() << "all current slots and previous slots ale cleared";
+    TRACE() << "all current slots and previous slots ale cleared";
 
     resetAllProperties();
 }
@@ -4354,6 +4451,7 @@ void JoyButton::resetAllProperties()
     springWidth = GlobalVariables::JoyButton::DEFAULTSPRINGWIDTH;
     springHeight = GlobalVariables::JoyButton::DEFAULTSPRINGHEIGHT;
     sensitivity = GlobalVariables::JoyButton::DEFAULTSENSITIVITY;
+    updateMouseCurveResponse();
     setSelection = GlobalVariables::JoyButton::DEFAULTSETSELECTION;
     setSelectionCondition = DEFAULTSETCONDITION;
     m_ignoresets = false;
@@ -4545,38 +4643,34 @@ double JoyButton::getCurrentSpringDeadCircle() { return (springDeadCircleMultipl
 
 void JoyButton::restartLastMouseTime(QElapsedTimer *testOldMouseTime) { testOldMouseTime->restart(); }
 
-void JoyButton::setStaticMouseThread(QThread *thread, QTimer *staticMouseEventTimer, QElapsedTimer *testOldMouseTime,
-                                     int idleMouseRefrRate, JoyButtonMouseHelper *mouseHelper)
+void JoyButton::setStaticMouseThread(QThread *thread, MouseEventScheduler *staticMouseEventTimer,
+                                     QElapsedTimer *testOldMouseTime, JoyButtonMouseHelper *mouseHelper)
 {
-    int oldInterval = staticMouseEventTimer->interval();
-
-    if (oldInterval == 0)
-        oldInterval = idleMouseRefrRate;
-
     staticMouseEventTimer->moveToThread(thread);
     mouseHelper->moveToThread(thread);
 
-    QMetaObject::invokeMethod(staticMouseEventTimer, "start", Q_ARG(int, oldInterval));
+    QMetaObject::invokeMethod(staticMouseEventTimer, "start");
 
     testOldMouseTime->start();
 }
 
-void JoyButton::indirectStaticMouseThread(QThread *thread, QTimer *staticMouseEventTimer, JoyButtonMouseHelper *mouseHelper)
+void JoyButton::indirectStaticMouseThread(QThread *thread, MouseEventScheduler *staticMouseEventTimer,
+                                          JoyButtonMouseHelper *mouseHelper)
 {
     QMetaObject::invokeMethod(staticMouseEventTimer, "stop");
     QMetaObject::invokeMethod(mouseHelper, "changeThread", Q_ARG(QThread *, thread));
 }
 
-bool JoyButton::shouldInvokeMouseEvents(QList<JoyButton *> *pendingMouseButtons, QTimer *staticMouseEventTimer,
-                                        QElapsedTimer *testOldMouseTime)
+bool JoyButton::shouldInvokeMouseEvents(QList<JoyButton *> *pendingMouseButtons,
+                                        MouseEventScheduler *staticMouseEventTimer, QElapsedTimer *testOldMouseTime)
 {
     bool result = false;
 
-    if ((staticMouseEventTimer->interval() == 0) && (pendingMouseButtons->size() > 0) && staticMouseEventTimer->isActive())
-        result = true;
-    else if ((testOldMouseTime->elapsed() >= staticMouseEventTimer->interval()) && (pendingMouseButtons->size() > 0) &&
-             staticMouseEventTimer->isActive())
-        result = true;
+    if ((pendingMouseButtons->size() > 0) && staticMouseEventTimer->isActive())
+    {
+        int intervalUsec = staticMouseEventTimer->intervalUsec();
+        result = (intervalUsec == 0) || ((testOldMouseTime->nsecsElapsed() / 1000) >= intervalUsec);
+    }
 
     return result;
 }
@@ -20,10 +20,13 @@
 #define JOYBUTTON_H
 
 #include "globalvariables.h"
+#include "inputtimer.h"
 #include "joybuttonmousehelper.h"
 #include "joybuttonslot.h"
+#include "mouseeventscheduler.h"
 #include "springmousemoveinfo.h"
 
+#include <QAtomicPointer>
 #include <QDeadlineTimer>
 #include <QQueue>
 #include <QReadWriteLock>
@@ -31,6 +34,7 @@
 #include <QThread>
 #include <QTimer>
 
+class JoyMouseCurveResponse;
 class VDPad;
 class SetJoystick;
 class QXmlStreamReader;
@@ -212,38 +216,39 @@ class JoyButton : public QObject
     TurboMode getTurboMode();
 
     static int calculateFinalMouseSpeed(JoyMouseCurve curve, int value, const float joyspeed);
+    static int benchmarkMouseCurves(int iterations);
 
     static bool hasCursorEvents(QList<JoyButton::mouseCursorInfo> *cursorXSpeedsList,
                                 QList<JoyButton::mouseCursorInfo> *cursorYSpeedsList); // JoyButtonEvents class
     static bool hasSpringEvents(QList<PadderCommon::springModeInfo> *springXSpeedsList,
                                 QList<PadderCommon::springModeInfo> *springYSpeedsList); // JoyButtonEvents class
-    static bool shouldInvokeMouseEvents(QList<JoyButton *> *pendingMouseButtons, QTimer *staticMouseEventTimer,
-                                        QElapsedTimer *testOldMouseTime);
-
-    static void setWeightModifier(double modifier, double maxWeightModifier, double &weightModifier);
-    static void moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QList<double> *mouseHistoryX,
-                                QList<double> *mouseHistoryY, QElapsedTimer *testOldMouseTime, QTimer *staticMouseEventTimer,
-                                int mouseRefreshRate, int mouseHistorySize, QList<JoyButton::mouseCursorInfo> *cursorXSpeeds,
+    static bool shouldInvokeMouseEvents(QList<JoyButton *> *pendingMouseButtons,
+                                        MouseEventScheduler *staticMouseEventTimer, QElapsedTimer *testOldMouseTime);
+
+    static void setWeightModifier(double modifier, double maxWeightModifier, double &weightModifier,
+                                  MouseSmoothingHistory *mouseHistory);
+    static void moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, MouseSmoothingHistory *mouseHistory,
+                                QElapsedTimer *testOldMouseTime, MouseEventScheduler *staticMouseEventTimer,
+                                int mouseRefreshPeriodUsec, QList<JoyButton::mouseCursorInfo> *cursorXSpeeds,
                                 QList<JoyButton::mouseCursorInfo> *cursorYSpeeds, double &cursorRemainderX,
-                                double &cursorRemainderY, double weightModifier, int idleMouseRefrRate,
-                                QList<JoyButton *> *pendingMouseButtonse);
+                                double &cursorRemainderY, QList<JoyButton *> *pendingMouseButtonse);
     static void moveSpringMouse(int &movedX, int &movedY, bool &hasMoved, int springModeScreen,
                                 QList<PadderCommon::springModeInfo> *springXSpeeds,
                                 QList<PadderCommon::springModeInfo> *springYSpeeds, QList<JoyButton *> *pendingMouseButtons,
-                                int mouseRefreshRate, int idleMouseRefrRate, QTimer *staticMouseEventTimer);
-    static void setMouseHistorySize(int size, int maxMouseHistSize, int &mouseHistSize, QList<double> *mouseHistoryX,
-                                    QList<double> *mouseHistoryY);
-    static void setMouseRefreshRate(int refresh, int &mouseRefreshRate, int idleMouseRefrRate,
-                                    JoyButtonMouseHelper *mouseHelper, QList<double> *mouseHistoryX,
-                                    QList<double> *mouseHistoryY, QElapsedTimer *testOldMouseTime,
-                                    QTimer *staticMouseEventTimer);
+                                MouseEventScheduler *staticMouseEventTimer);
+    static void setMouseHistorySize(int size, int maxMouseHistSize, int &mouseHistSize,
+                                    MouseSmoothingHistory *mouseHistory);
+    static void setMouseRefreshPeriod(int periodUsec, int &mouseRefreshRate, int &mouseRefreshPeriodUsec,
+                                      JoyButtonMouseHelper *mouseHelper, MouseSmoothingHistory *mouseHistory,
+                                      QElapsedTimer *testOldMouseTime, MouseEventScheduler *staticMouseEventTimer);
     static void setSpringModeScreen(int screen, int &springModeScreen);
     static void resetActiveButtonMouseDistances(JoyButtonMouseHelper *mouseHelper);
     static void setGamepadRefreshRate(int refresh, int &gamepadRefreshRate, JoyButtonMouseHelper *mouseHelper);
     static void restartLastMouseTime(QElapsedTimer *testOldMouseTime);
-    static void setStaticMouseThread(QThread *thread, QTimer *staticMouseEventTimer, QElapsedTimer *testOldMouseTime,
-                                     int idleMouseRefrRate, JoyButtonMouseHelper *mouseHelper);
-    static void indirectStaticMouseThread(QThread *thread, QTimer *staticMouseEventTimer, JoyButtonMouseHelper *mouseHelper);
+    static void setStaticMouseThread(QThread *thread, MouseEventScheduler *staticMouseEventTimer,
+                                     QElapsedTimer *testOldMouseTime, JoyButtonMouseHelper *mouseHelper);
+    static void indirectStaticMouseThread(QThread *thread, MouseEventScheduler *staticMouseEventTimer,
+                                          JoyButtonMouseHelper *mouseHelper);
     static void invokeMouseEvents(JoyButtonMouseHelper *mouseHelper); // JoyButtonEvents class
 
     static JoyButtonMouseHelper *getMouseHelper();
@@ -252,7 +257,7 @@ class JoyButton : public QObject
     static QList<JoyButton::mouseCursorInfo> *getCursorYSpeeds();
     static QList<PadderCommon::springModeInfo> *getSpringXSpeeds();
     static QList<PadderCommon::springModeInfo> *getSpringYSpeeds();
-    static QTimer *getStaticMouseEventTimer(); // JoyButtonEvents class
+    static MouseEventScheduler *getStaticMouseEventTimer(); // JoyButtonEvents class
     static QElapsedTimer *getTestOldMouseTime();
 
     JoyExtraAccelerationCurve getExtraAccelerationCurve();
@@ -265,6 +270,7 @@ class JoyButton : public QObject
 
     bool insertAssignedSlot(JoyButtonSlot *slot, bool updateActiveString = true); // JoyButtonSlots class
     bool insertAssignedSlot(JoyButtonSlot *newSlot, int index, bool updateActiveString = true);
+    bool containsSetChangeSlots();
     bool containsJoyMixSlot();
 
   protected:
@@ -315,9 +321,9 @@ class JoyButton : public QObject
     double lastWheelVerticalDistance;
     double lastWheelHorizontalDistance;
 
-    QTimer turboTimer;
-    QTimer mouseWheelVerticalEventTimer;
-    QTimer mouseWheelHorizontalEventTimer;
+    InputTimer turboTimer;
+    InputTimer mouseWheelVerticalEventTimer;
+    InputTimer mouseWheelHorizontalEventTimer;
 
     QElapsedTimer wheelVerticalTime;
     QElapsedTimer wheelHorizontalTime;
@@ -417,6 +423,8 @@ class JoyButton : public QObject
     void slotSetChange();
 
   private:
+    void updateMouseCurveResponse();
+
     inline void updatePendingParams(bool isEvent, bool isPressed, bool areIgnoredSets)
     {
         pendingEvent = isEvent;
@@ -525,7 +533,7 @@ class JoyButton : public QObject
     void resetAllProperties();
     void resetPrivVars();
     void restartAllForSetChange();
-    void startTimerOverrun(int slotCode, QElapsedTimer *currSlotTime, QTimer *currSlotTimer, bool releasedDeskTimer = false);
+    void startTimerOverrun(int slotCode, QElapsedTimer *currSlotTime, InputTimer *currSlotTimer, bool releasedDeskTimer = false);
     void findJoySlotsEnd(QListIterator<JoyButtonSlot *> *slotiter);
     void changeStatesQueue(bool currentReleased);
     void countActiveSlots(int tempcode, int &references, JoyButtonSlot *slot, QHash<int, int> &activeSlotsHash,
@@ -535,13 +543,12 @@ class JoyButton : public QObject
     void setSpringDeadCircle(double &springDeadCircle, int mouseDirection);
     void checkSpringDeadCircle(int tempcode, double &springDeadCircle, int mouseSlot1, int mouseSlot2);
     static void distanceForMovingAx(double &finalAx, mouseCursorInfo infoAx);
-    static void adjustAxForCursor(QList<double> *mouseHistoryList, double &adjustedAx, double &cursorRemainder,
-                                  double weightModifier);
+    static void adjustAxForCursor(double &adjustedAx, double &cursorRemainder);
     void setDistanceForSpring(JoyButtonMouseHelper &mouseHelper, double &mouseFirstAx, double &mouseSecondAx,
                               double distanceFromDeadZone);
     void changeTurboParams(bool _isKeyPressed, bool isButtonPressed);
     void updateParamsAfterDistEvent(); // JoyButtonEvents class
-    void startSequenceOfPressActive(bool isTurbo, QString debugText);
+    void startSequenceOfPressActive(bool isTurbo, const char *debugText);
     QList<JoyButtonSlot *> &getAssignmentsLocal();
     QList<JoyButtonSlot *> &getActiveSlotsLocal(); // JoyButtonSlots class
     void updateMouseProperties(double newAxisValue, double newSpringDead, int newSpringWidth, int newSpringHeight,
@@ -600,16 +607,16 @@ class JoyButton : public QObject
     double m_easingDuration;
     double extraAccelerationMultiplier;
 
-    QTimer pauseTimer;
-    QTimer holdTimer;
-    QTimer pauseWaitTimer;
-    QTimer createDeskTimer;
-    QTimer releaseDeskTimer;
-    QTimer setChangeTimer;
-    QTimer keyPressTimer;
-    QTimer delayTimer;
-    QTimer slotSetChangeTimer;
-    static QTimer staticMouseEventTimer; // JoyButtonEvents class
+    InputTimer pauseTimer;
+    InputTimer holdTimer;
+    InputTimer pauseWaitTimer;
+    InputTimer createDeskTimer;
+    InputTimer releaseDeskTimer;
+    InputTimer setChangeTimer;
+    InputTimer keyPressTimer;
+    InputTimer delayTimer;
+    InputTimer slotSetChangeTimer;
+    static MouseEventScheduler staticMouseEventTimer; // JoyButtonEvents class
 
     QString customName;
     QString actionName;
@@ -643,6 +650,7 @@ class JoyButton : public QObject
     VDPad *m_vdpad;
     JoyMouseMovementMode mouseMode;
     JoyMouseCurve mouseCurve;
+    QAtomicPointer<const JoyMouseCurveResponse> m_mouse_curve_response;
     JoyExtraAccelerationCurve extraAccelCurve;
 
     QReadWriteLock activeZoneLock;
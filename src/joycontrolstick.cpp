@@ -22,6 +22,7 @@
 #include "joyaxis.h"
 #include "joybuttontypes/joycontrolstickbutton.h"
 #include "joybuttontypes/joycontrolstickmodifierbutton.h"
+#include "profilereader.h"
 #include "xml/joybuttonxml.h"
 
 #include <QDebug>
@@ -29,13 +30,15 @@
 #include <QLabel>
 #include <QPointer>
 #include <QStringList>
-#include <QXmlStreamReader>
+#include <QThread>
 #include <QXmlStreamWriter>
 //#include <QtTest/QTest>
 
 #include <math.h>
 
 const JoyControlStick::JoyMode JoyControlStick::DEFAULTMODE = JoyControlStick::StandardMode;
+const int JoyControlStick::FOUR_WAY_CARDINAL_ZONE_ANGLES[4] = {45, 135, 225, 315};
+const int JoyControlStick::FOUR_WAY_DIAGONAL_ZONE_ANGLES[4] = {0, 90, 180, 270};
 
 JoyControlStick::JoyControlStick(JoyAxis *axis1, JoyAxis *axis2, int index, int originset, QObject *parent)
     : QObject(parent)
@@ -327,6 +330,49 @@ void JoyControlStick::createDeskEvent(bool ignoresets)
     }
 }
 
+/**
+ * @brief Get the polar coordinates of a stick position. The result of the
+ *   last position is kept, so the many bearing and distance calculations of
+ *   one stick event only evaluate the trigonometric functions once.
+ *   Only the thread owning the stick uses the kept result.
+ * @param X axis value
+ * @param Y axis value
+ * @return Polar coordinates of the position
+ */
+JoyControlStick::PolarState JoyControlStick::getPolarState(int axisXValue, int axisYValue)
+{
+    bool memoize = QThread::currentThread() == thread();
+
+    if (memoize && m_polar_state_valid && (m_polar_state.axisXValue == axisXValue) &&
+        (m_polar_state.axisYValue == axisYValue) && (m_polar_state.circle == circle))
+    {
+        return m_polar_state;
+    }
+
+    PolarState state;
+    state.axisXValue = axisXValue;
+    state.axisYValue = axisYValue;
+    state.circle = circle;
+    state.angle = atan2(axisXValue, -axisYValue);
+    state.angleSin = sin(state.angle);
+    state.angleCos = cos(state.angle);
+
+    int squared_dist = (axisXValue * axisXValue) + (axisYValue * axisYValue);
+    state.distance = sqrt(squared_dist);
+
+    double squareStickFullPhi = qMin(state.angleSin != 0.0 ? 1 / fabs(state.angleSin) : 2,
+                                     state.angleCos != 0.0 ? 1 / fabs(state.angleCos) : 2);
+    state.circleStickFull = (squareStickFullPhi - 1) * circle + 1;
+
+    if (memoize)
+    {
+        m_polar_state = state;
+        m_polar_state_valid = true;
+    }
+
+    return state;
+}
+
 /**
  * @brief Calculate the bearing (in degrees) corresponding to the current
  *   position of the X and Y axes of a stick.
@@ -355,9 +401,7 @@ double JoyControlStick::calculateBearing(int axisXValue, int axisYValue)
         finalAngle = 0.0;
     } else
     {
-        double temp1 = axis1Value;
-        double temp2 = axis2Value;
-        double angle = (atan2(temp1, -temp2) * 180) / GlobalVariables::JoyControlStick::PI;
+        double angle = (getPolarState(axis1Value, axis2Value).angle * 180) / GlobalVariables::JoyControlStick::PI;
 
         if ((axis1Value >= 0) && (axis2Value <= 0))
         {
@@ -405,16 +449,9 @@ double JoyControlStick::getDistanceFromDeadZone(int axisXValue, int axisYValue)
     int axis1Value = axisXValue;
     int axis2Value = axisYValue;
 
-    double angle2 = atan2(axis1Value, -axis2Value);
-    double ang_sin = sin(angle2);
-    double ang_cos = cos(angle2);
-
-    int squared_dist = (axis1Value * axis1Value) + (axis2Value * axis2Value);
-    int dist = sqrt(squared_dist);
-
-    double squareStickFullPhi = qMin((ang_sin != 0.0) ? 1 / fabs(ang_sin) : 2, ang_cos != 0.0 ? 1 / fabs(ang_cos) : 2);
-    double circle = this->circle;
-    double circleStickFull = (squareStickFullPhi - 1) * circle + 1;
+    PolarState state = getPolarState(axis1Value, axis2Value);
+    int dist = static_cast<int>(state.distance);
+    double circleStickFull = state.circleStickFull;
 
     double adjustedDist = (circleStickFull > 1.0) ? (dist / circleStickFull) : dist;
     double adjustedDeadZone = (circleStickFull > 1.0) ? (deadZone / circleStickFull) : deadZone;
@@ -449,15 +486,10 @@ double JoyControlStick::calculateYDistanceFromDeadZone(int axisXValue, int axisY
     int axis1Value = axisXValue;
     int axis2Value = axisYValue;
 
-    double angle2 = atan2(axis1Value, -axis2Value);
-    double ang_sin = sin(angle2);
-    double ang_cos = cos(angle2);
-
-    int deadY = abs(floor(deadZone * ang_cos + 0.5));
+    PolarState state = getPolarState(axis1Value, axis2Value);
 
-    double squareStickFullPhi = qMin(ang_sin != 0.0 ? 1 / fabs(ang_sin) : 2, ang_cos != 0.0 ? 1 / fabs(ang_cos) : 2);
-    double circle = this->circle;
-    double circleStickFull = (squareStickFullPhi - 1) * circle + 1;
+    int deadY = abs(floor(deadZone * state.angleCos + 0.5));
+    double circleStickFull = state.circleStickFull;
 
     double adjustedAxis2Value = (circleStickFull > 1.0) ? (axis2Value / circleStickFull) : axis2Value;
     double adjustedDeadYZone = (circleStickFull > 1.0) ? (deadY / circleStickFull) : deadY;
@@ -469,10 +501,8 @@ double JoyControlStick::calculateYDistanceFromDeadZone(int axisXValue, int axisY
         JoyStickDirections direction = calculateStickDirection(axis1Value, axis2Value);
         if ((direction == StickRightUp) || (direction == StickUp))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double minangle = tempangles.at(1);
-            double square_dist = getAbsoluteRawDistance(axis1Value, axis2Value);
+            double minangle = m_diagonal_zone_angles[1];
+            double square_dist = state.distance;
             double mindeadY = fabs(square_dist * sin(minangle * GlobalVariables::JoyControlStick::PI / 180.0));
             double currentDeadY = qMax(adjustedDeadYZone, mindeadY);
             double maxRange = static_cast<double>(maxZone) - currentDeadY;
@@ -484,10 +514,8 @@ double JoyControlStick::calculateYDistanceFromDeadZone(int axisXValue, int axisY
             distance = tempdist4;
         } else if ((direction == StickRightDown) || (direction == StickRight))
         {
-            QList<double> tempfuck = getDiagonalZoneAngles();
-
-            double minangle = tempfuck.at(4);
-            double square_dist = getAbsoluteRawDistance(axis1Value, axis2Value);
+            double minangle = m_diagonal_zone_angles[4];
+            double square_dist = state.distance;
             double mindeadY = fabs(square_dist * sin((minangle - 90.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             double currentDeadY = qMax(adjustedDeadYZone, mindeadY);
             double maxRange = static_cast<double>(maxZone) - currentDeadY;
@@ -499,10 +527,8 @@ double JoyControlStick::calculateYDistanceFromDeadZone(int axisXValue, int axisY
             distance = tempdist4;
         } else if ((direction == StickLeftDown) || (direction == StickDown))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double minangle = tempangles.at(6);
-            double square_dist = getAbsoluteRawDistance(axis1Value, axis2Value);
+            double minangle = m_diagonal_zone_angles[6];
+            double square_dist = state.distance;
             double mindeadY = fabs(square_dist * sin((minangle - 180.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             double currentDeadY = qMax(adjustedDeadYZone, mindeadY);
             double maxRange = static_cast<double>(maxZone) - currentDeadY;
@@ -514,10 +540,8 @@ double JoyControlStick::calculateYDistanceFromDeadZone(int axisXValue, int axisY
             distance = tempdist4;
         } else if ((direction == StickLeftUp) || (direction == StickLeft))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double minangle = tempangles.at(8);
-            double square_dist = getAbsoluteRawDistance(axis1Value, axis2Value);
+            double minangle = m_diagonal_zone_angles[8];
+            double square_dist = state.distance;
             double mindeadY = fabs(square_dist * sin((minangle - 270.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             double currentDeadY = qMax(adjustedDeadYZone, mindeadY);
             double maxRange = static_cast<double>(maxZone) - currentDeadY;
@@ -579,14 +603,10 @@ double JoyControlStick::calculateXDistanceFromDeadZone(int axisXValue, int axisY
     int axis1Value = axisXValue;
     int axis2Value = axisYValue;
 
-    double angle2 = atan2(axis1Value, -axis2Value);
-    double ang_sin = sin(angle2);
-    double ang_cos = cos(angle2);
+    PolarState state = getPolarState(axis1Value, axis2Value);
 
-    int deadX = abs(floor(deadZone * ang_sin + 0.5));
-    double squareStickFullPhi = qMin(ang_sin != 0.0 ? 1 / fabs(ang_sin) : 2, ang_cos != 0.0 ? 1 / fabs(ang_cos) : 2);
-    double circle = this->circle;
-    double circleStickFull = (squareStickFullPhi - 1) * circle + 1;
+    int deadX = abs(floor(deadZone * state.angleSin + 0.5));
+    double circleStickFull = state.circleStickFull;
 
     double adjustedAxis1Value = (circleStickFull > 1.0) ? (axis1Value / circleStickFull) : axis1Value;
     double adjustedDeadXZone = (circleStickFull > 1.0) ? (deadX / circleStickFull) : deadX;
@@ -599,10 +619,8 @@ double JoyControlStick::calculateXDistanceFromDeadZone(int axisXValue, int axisY
 
         if ((direction == StickRightUp) || (direction == StickRight))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double maxangle = tempangles.at(3);
-            double square_dist = getAbsoluteRawDistance(axis1Value, axis2Value);
+            double maxangle = m_diagonal_zone_angles[3];
+            double square_dist = state.distance;
             double mindeadX = fabs(square_dist * cos(maxangle * GlobalVariables::JoyControlStick::PI / 180.0));
             double currentDeadX = qMax(mindeadX, adjustedDeadXZone);
             double maxRange = static_cast<double>(maxZone) - currentDeadX;
@@ -614,10 +632,8 @@ double JoyControlStick::calculateXDistanceFromDeadZone(int axisXValue, int axisY
             distance = tempdist4;
         } else if ((direction == StickRightDown) || (direction == StickDown))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double maxangle = tempangles.at(5);
-            double square_dist = getAbsoluteRawDistance(axis1Value, axis2Value);
+            double maxangle = m_diagonal_zone_angles[5];
+            double square_dist = state.distance;
             double mindeadX = fabs(square_dist * cos((maxangle - 90.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             double currentDeadX = qMax(mindeadX, adjustedDeadXZone);
             double maxRange = static_cast<double>(maxZone) - currentDeadX;
@@ -629,10 +645,8 @@ double JoyControlStick::calculateXDistanceFromDeadZone(int axisXValue, int axisY
             distance = tempdist4;
         } else if ((direction == StickLeftDown) || (direction == StickLeft))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double maxangle = tempangles.at(7);
-            double square_dist = getAbsoluteRawDistance(axis1Value, axis2Value);
+            double maxangle = m_diagonal_zone_angles[7];
+            double square_dist = state.distance;
             double mindeadX = fabs(square_dist * cos((maxangle - 180.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             double currentDeadX = qMax(mindeadX, adjustedDeadXZone);
             double maxRange = static_cast<double>(maxZone) - currentDeadX;
@@ -644,10 +658,8 @@ double JoyControlStick::calculateXDistanceFromDeadZone(int axisXValue, int axisY
             distance = tempdist4;
         } else if ((direction == StickLeftUp) || (direction == StickUp))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double maxangle = tempangles.at(1);
-            double square_dist = getAbsoluteRawDistance(axis1Value, axis2Value);
+            double maxangle = m_diagonal_zone_angles[1];
+            double square_dist = state.distance;
             double mindeadX = fabs(square_dist * cos((maxangle - 270.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             double currentDeadX = qMax(mindeadX, adjustedDeadXZone);
             double maxRange = static_cast<double>(maxZone) - currentDeadX;
@@ -851,6 +863,7 @@ void JoyControlStick::reset()
     m_modifier_zone = GlobalVariables::JoyControlStick::DEFAULTMODIFIERZONE;
     m_modifier_zone_inverted = GlobalVariables::JoyControlStick::DEFAULTMODIFIERZONEINVERTED;
     diagonalRange = GlobalVariables::JoyControlStick::DEFAULTDIAGONALRANGE;
+    rebuildDiagonalZoneAngles();
     isActive = false;
     pendingStickEvent = false;
 
@@ -977,6 +990,7 @@ void JoyControlStick::setDiagonalRange(int value)
     if (value != diagonalRange)
     {
         diagonalRange = value;
+        rebuildDiagonalZoneAngles();
         emit diagonalRangeChanged(value);
         emit propertyUpdated();
     }
@@ -985,9 +999,9 @@ void JoyControlStick::setDiagonalRange(int value)
 /**
  * @brief Take a XML stream and set the stick and direction button properties
  *     according to the values contained within the stream.
- * @param QXmlStreamReader instance that will be used to read property values.
+ * @param ProfileReader instance that will be used to read property values.
  */
-void JoyControlStick::readConfig(QXmlStreamReader *xml)
+void JoyControlStick::readConfig(ProfileReader *xml)
 {
     if (xml->isStartElement() && (xml->name() == "stick"))
     {
@@ -1706,16 +1720,7 @@ int JoyControlStick::calculateCircleXValue(int axisXValue, int axisYValue)
 
     if (this->circle > 0.0)
     {
-        int axis1Value = axisXValue;
-        int axis2Value = axisYValue;
-
-        double angle2 = atan2(axis1Value, -axis2Value);
-        double ang_sin = sin(angle2);
-        double ang_cos = cos(angle2);
-
-        double squareStickFull = qMin(ang_sin != 0.0 ? 1 / fabs(ang_sin) : 2, ang_cos != 0.0 ? 1 / fabs(ang_cos) : 2);
-        double circle = this->circle;
-        double circleStickFull = (squareStickFull - 1) * circle + 1;
+        double circleStickFull = getPolarState(axisXValue, axisYValue).circleStickFull;
 
         value = (circleStickFull > 1.0) ? floor((axisXValue / circleStickFull) + 0.5) : value;
     }
@@ -1729,16 +1734,7 @@ int JoyControlStick::calculateCircleYValue(int axisXValue, int axisYValue)
 
     if (this->circle > 0.0)
     {
-        int axis1Value = axisXValue;
-        int axis2Value = axisYValue;
-
-        double angle2 = atan2(axis1Value, -axis2Value);
-        double ang_sin = sin(angle2);
-        double ang_cos = cos(angle2);
-
-        double squareStickFull = qMin(ang_sin != 0.0 ? 1 / fabs(ang_sin) : 2, ang_cos != 0.0 ? 1 / fabs(ang_cos) : 2);
-        double circle = this->circle;
-        double circleStickFull = (squareStickFull - 1) * circle + 1;
+        double circleStickFull = getPolarState(axisXValue, axisYValue).circleStickFull;
 
         value = (circleStickFull > 1.0) ? floor((axisYValue / circleStickFull) + 0.5) : value;
     }
@@ -1750,30 +1746,8 @@ QList<double> JoyControlStick::getDiagonalZoneAngles()
 {
     QList<double> anglesList;
 
-    int diagonalAngle = diagonalRange;
-
-    double cardinalAngle = (360 - (diagonalAngle * 4)) / 4.0;
-
-    double initialLeft = 360 - ((cardinalAngle) / 2.0);
-    double initialRight = ((cardinalAngle) / 2.0);
-
-    double upRightInitial = initialRight;
-    double rightInitial = upRightInitial + diagonalAngle;
-    double downRightInitial = rightInitial + cardinalAngle;
-    double downInitial = downRightInitial + diagonalAngle;
-    double downLeftInitial = downInitial + cardinalAngle;
-    double leftInitial = downLeftInitial + diagonalAngle;
-    double upLeftInitial = leftInitial + cardinalAngle;
-
-    anglesList.append(initialLeft);
-    anglesList.append(initialRight);
-    anglesList.append(upRightInitial);
-    anglesList.append(rightInitial);
-    anglesList.append(downRightInitial);
-    anglesList.append(downInitial);
-    anglesList.append(downLeftInitial);
-    anglesList.append(leftInitial);
-    anglesList.append(upLeftInitial);
+    for (double angle : m_diagonal_zone_angles)
+        anglesList.append(angle);
 
     return anglesList;
 }
@@ -1782,17 +1756,8 @@ QList<int> JoyControlStick::getFourWayCardinalZoneAngles()
 {
     QList<int> anglesList;
 
-    int zoneRange = 90;
-
-    int rightInitial = 45;
-    int downInitial = rightInitial + zoneRange;
-    int leftInitial = downInitial + zoneRange;
-    int upInitial = leftInitial + zoneRange;
-
-    anglesList.append(rightInitial);
-    anglesList.append(downInitial);
-    anglesList.append(leftInitial);
-    anglesList.append(upInitial);
+    for (int angle : FOUR_WAY_CARDINAL_ZONE_ANGLES)
+        anglesList.append(angle);
 
     return anglesList;
 }
@@ -1801,19 +1766,42 @@ QList<int> JoyControlStick::getFourWayDiagonalZoneAngles()
 {
     QList<int> anglesList;
 
-    int zoneRange = 90;
+    for (int angle : FOUR_WAY_DIAGONAL_ZONE_ANGLES)
+        anglesList.append(angle);
+
+    return anglesList;
+}
 
-    int upRightInitial = 0;
-    int downRightInitial = zoneRange;
-    int downLeftInitial = downRightInitial + zoneRange;
-    int upLeftInitial = downLeftInitial + zoneRange;
+/**
+ * @brief Recalculates the zone boundaries used to classify the stick
+ *  direction. Has to be called whenever diagonalRange changes.
+ */
+void JoyControlStick::rebuildDiagonalZoneAngles()
+{
+    int diagonalAngle = diagonalRange;
 
-    anglesList.append(upRightInitial);
-    anglesList.append(downRightInitial);
-    anglesList.append(downLeftInitial);
-    anglesList.append(upLeftInitial);
+    double cardinalAngle = (360 - (diagonalAngle * 4)) / 4.0;
 
-    return anglesList;
+    double initialLeft = 360 - ((cardinalAngle) / 2.0);
+    double initialRight = ((cardinalAngle) / 2.0);
+
+    double upRightInitial = initialRight;
+    double rightInitial = upRightInitial + diagonalAngle;
+    double downRightInitial = rightInitial + cardinalAngle;
+    double downInitial = downRightInitial + diagonalAngle;
+    double downLeftInitial = downInitial + cardinalAngle;
+    double leftInitial = downLeftInitial + diagonalAngle;
+    double upLeftInitial = leftInitial + cardinalAngle;
+
+    m_diagonal_zone_angles[0] = initialLeft;
+    m_diagonal_zone_angles[1] = initialRight;
+    m_diagonal_zone_angles[2] = upRightInitial;
+    m_diagonal_zone_angles[3] = rightInitial;
+    m_diagonal_zone_angles[4] = downRightInitial;
+    m_diagonal_zone_angles[5] = downInitial;
+    m_diagonal_zone_angles[6] = downLeftInitial;
+    m_diagonal_zone_angles[7] = leftInitial;
+    m_diagonal_zone_angles[8] = upLeftInitial;
 }
 
 QHash<JoyControlStick::JoyStickDirections, JoyControlStickButton *> *JoyControlStick::getButtons() { return &buttons; }
@@ -2260,16 +2248,16 @@ void JoyControlStick::determineStandardModeEvent(JoyControlStickButton *&eventbu
 {
     double bearing = calculateBearing();
 
-    QList<double> anglesList = getDiagonalZoneAngles();
-    double initialLeft = anglesList.value(0);
-    double initialRight = anglesList.value(1);
-    double upRightInitial = anglesList.value(2);
-    double rightInitial = anglesList.value(3);
-    double downRightInitial = anglesList.value(4);
-    double downInitial = anglesList.value(5);
-    double downLeftInitial = anglesList.value(6);
-    double leftInitial = anglesList.value(7);
-    double upLeftInitial = anglesList.value(8);
+    const double *anglesList = m_diagonal_zone_angles;
+    double initialLeft = anglesList[0];
+    double initialRight = anglesList[1];
+    double upRightInitial = anglesList[2];
+    double rightInitial = anglesList[3];
+    double downRightInitial = anglesList[4];
+    double downInitial = anglesList[5];
+    double downLeftInitial = anglesList[6];
+    double leftInitial = anglesList[7];
+    double upLeftInitial = anglesList[8];
 
     if ((bearing <= initialRight) || (bearing >= initialLeft))
     {
@@ -2322,16 +2310,16 @@ void JoyControlStick::determineEightWayModeEvent(JoyControlStickButton *&eventbu
 {
     double bearing = calculateBearing();
 
-    QList<double> anglesList = getDiagonalZoneAngles();
-    double initialLeft = anglesList.value(0);
-    double initialRight = anglesList.value(1);
-    double upRightInitial = anglesList.value(2);
-    double rightInitial = anglesList.value(3);
-    double downRightInitial = anglesList.value(4);
-    double downInitial = anglesList.value(5);
-    double downLeftInitial = anglesList.value(6);
-    double leftInitial = anglesList.value(7);
-    double upLeftInitial = anglesList.value(8);
+    const double *anglesList = m_diagonal_zone_angles;
+    double initialLeft = anglesList[0];
+    double initialRight = anglesList[1];
+    double upRightInitial = anglesList[2];
+    double rightInitial = anglesList[3];
+    double downRightInitial = anglesList[4];
+    double downInitial = anglesList[5];
+    double downLeftInitial = anglesList[6];
+    double leftInitial = anglesList[7];
+    double upLeftInitial = anglesList[8];
 
     if ((bearing <= initialRight) || (bearing >= initialLeft))
     {
@@ -2379,11 +2367,11 @@ void JoyControlStick::determineFourWayCardinalEvent(JoyControlStickButton *&even
 {
     double bearing = calculateBearing();
 
-    QList<int> anglesList = getFourWayCardinalZoneAngles();
-    int rightInitial = anglesList.value(0);
-    int downInitial = anglesList.value(1);
-    int leftInitial = anglesList.value(2);
-    int upInitial = anglesList.value(3);
+    const int *anglesList = FOUR_WAY_CARDINAL_ZONE_ANGLES;
+    int rightInitial = anglesList[0];
+    int downInitial = anglesList[1];
+    int leftInitial = anglesList[2];
+    int upInitial = anglesList[3];
 
     if ((bearing < rightInitial) || (bearing >= upInitial))
     {
@@ -2413,11 +2401,11 @@ void JoyControlStick::determineFourWayDiagonalEvent(JoyControlStickButton *&even
 {
     double bearing = calculateBearing();
 
-    QList<int> anglesList = getFourWayDiagonalZoneAngles();
-    int upRightInitial = anglesList.value(0);
-    int downRightInitial = anglesList.value(1);
-    int downLeftInitial = anglesList.value(2);
-    int upLeftInitial = anglesList.value(3);
+    const int *anglesList = FOUR_WAY_DIAGONAL_ZONE_ANGLES;
+    int upRightInitial = anglesList[0];
+    int downRightInitial = anglesList[1];
+    int downLeftInitial = anglesList[2];
+    int upLeftInitial = anglesList[3];
 
     if ((bearing >= upRightInitial) && (bearing < downRightInitial))
     {
@@ -2453,16 +2441,16 @@ JoyControlStick::JoyStickDirections JoyControlStick::determineStandardModeDirect
 
     double bearing = calculateBearing(axisXValue, axisYValue);
 
-    QList<double> anglesList = getDiagonalZoneAngles();
-    int initialLeft = anglesList.value(0);
-    int initialRight = anglesList.value(1);
-    int upRightInitial = anglesList.value(2);
-    int rightInitial = anglesList.value(3);
-    int downRightInitial = anglesList.value(4);
-    int downInitial = anglesList.value(5);
-    int downLeftInitial = anglesList.value(6);
-    int leftInitial = anglesList.value(7);
-    int upLeftInitial = anglesList.value(8);
+    const double *anglesList = m_diagonal_zone_angles;
+    int initialLeft = anglesList[0];
+    int initialRight = anglesList[1];
+    int upRightInitial = anglesList[2];
+    int rightInitial = anglesList[3];
+    int downRightInitial = anglesList[4];
+    int downInitial = anglesList[5];
+    int downLeftInitial = anglesList[6];
+    int leftInitial = anglesList[7];
+    int upLeftInitial = anglesList[8];
 
     if ((bearing <= initialRight) || (bearing >= initialLeft))
     {
@@ -2523,11 +2511,11 @@ JoyControlStick::JoyStickDirections JoyControlStick::determineFourWayCardinalDir
 
     double bearing = calculateBearing(axisXValue, axisYValue);
 
-    QList<int> anglesList = getFourWayCardinalZoneAngles();
-    int rightInitial = anglesList.value(0);
-    int downInitial = anglesList.value(1);
-    int leftInitial = anglesList.value(2);
-    int upInitial = anglesList.value(3);
+    const int *anglesList = FOUR_WAY_CARDINAL_ZONE_ANGLES;
+    int rightInitial = anglesList[0];
+    int downInitial = anglesList[1];
+    int leftInitial = anglesList[2];
+    int upInitial = anglesList[3];
 
     if ((bearing < rightInitial) || (bearing >= upInitial))
     {
@@ -2560,11 +2548,11 @@ JoyControlStick::JoyStickDirections JoyControlStick::determineFourWayDiagonalDir
 {
     JoyStickDirections result = StickCentered;
     double bearing = calculateBearing(axisXValue, axisYValue);
-    QList<int> anglesList = getFourWayDiagonalZoneAngles();
-    int upRightInitial = anglesList.value(0);
-    int downRightInitial = anglesList.value(1);
-    int downLeftInitial = anglesList.value(2);
-    int upLeftInitial = anglesList.value(3);
+    const int *anglesList = FOUR_WAY_DIAGONAL_ZONE_ANGLES;
+    int upRightInitial = anglesList[0];
+    int downRightInitial = anglesList[1];
+    int downLeftInitial = anglesList[2];
+    int upLeftInitial = anglesList[3];
 
     if ((bearing >= upRightInitial) && (bearing < downRightInitial))
     {
@@ -2708,6 +2696,7 @@ void JoyControlStick::copyAssignments(JoyControlStick *destStick)
     destStick->m_modifier_zone = m_modifier_zone;
     destStick->m_modifier_zone_inverted = m_modifier_zone_inverted;
     destStick->diagonalRange = diagonalRange;
+    destStick->rebuildDiagonalZoneAngles();
     destStick->currentDirection = currentDirection;
     destStick->currentMode = currentMode;
     destStick->stickName = stickName;
@@ -3665,30 +3654,22 @@ double JoyControlStick::calculateXDiagonalDeadZone(int axisXValue, int axisYValu
     {
         if ((direction == StickRightUp) || (direction == StickRight))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double maxangle = tempangles.at(3);
+            double maxangle = m_diagonal_zone_angles[3];
             double mindeadX = fabs(deadZone * cos(maxangle * GlobalVariables::JoyControlStick::PI / 180.0));
             diagonalDeadZone = mindeadX;
         } else if ((direction == StickRightDown) || (direction == StickDown))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double maxangle = tempangles.at(5);
+            double maxangle = m_diagonal_zone_angles[5];
             double mindeadX = fabs(deadZone * cos((maxangle - 90.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             diagonalDeadZone = mindeadX;
         } else if ((direction == StickLeftDown) || (direction == StickLeft))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double maxangle = tempangles.at(7);
+            double maxangle = m_diagonal_zone_angles[7];
             double mindeadX = fabs(deadZone * cos((maxangle - 180.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             diagonalDeadZone = mindeadX;
         } else if ((direction == StickLeftUp) || (direction == StickUp))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double maxangle = tempangles.at(1);
+            double maxangle = m_diagonal_zone_angles[1];
             double mindeadX = fabs(deadZone * cos((maxangle - 270.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             diagonalDeadZone = mindeadX;
         } else
@@ -3712,30 +3693,22 @@ double JoyControlStick::calculateYDiagonalDeadZone(int axisXValue, int axisYValu
     {
         if ((direction == StickRightUp) || (direction == StickUp))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double minangle = tempangles.at(1);
+            double minangle = m_diagonal_zone_angles[1];
             double mindeadY = fabs(deadZone * sin(minangle * GlobalVariables::JoyControlStick::PI / 180.0));
             diagonalDeadZone = mindeadY;
         } else if ((direction == StickRightDown) || (direction == StickRight))
         {
-            QList<double> tempfuck = getDiagonalZoneAngles();
-
-            double minangle = tempfuck.at(4);
+            double minangle = m_diagonal_zone_angles[4];
             double mindeadY = fabs(deadZone * sin((minangle - 90.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             diagonalDeadZone = mindeadY;
         } else if ((direction == StickLeftDown) || (direction == StickDown))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double minangle = tempangles.at(6);
+            double minangle = m_diagonal_zone_angles[6];
             double mindeadY = fabs(deadZone * sin((minangle - 180.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             diagonalDeadZone = mindeadY;
         } else if ((direction == StickLeftUp) || (direction == StickLeft))
         {
-            QList<double> tempangles = getDiagonalZoneAngles();
-
-            double minangle = tempangles.at(8);
+            double minangle = m_diagonal_zone_angles[8];
             double mindeadY = fabs(deadZone * sin((minangle - 270.0) * GlobalVariables::JoyControlStick::PI / 180.0));
             diagonalDeadZone = mindeadY;
         } else
@@ -3753,7 +3726,6 @@ double JoyControlStick::calculateYDiagonalDeadZone(int axisXValue, int axisYValu
 double JoyControlStick::getSpringDeadCircleX()
 {
     double result = 0.0;
-    double angle2 = 0.0;
     int axis1Value = 0;
     int axis2Value = 0;
 
@@ -3761,26 +3733,20 @@ double JoyControlStick::getSpringDeadCircleX()
     {
         // Stick moved back to absolute center. Use previously available values
         // to find stick angle.
-        angle2 = atan2(axisX->getLastKnownRawValue(), -axisY->getLastKnownRawValue());
         axis1Value = axisX->getLastKnownRawValue();
         axis2Value = axisY->getLastKnownRawValue();
     } else
     {
         // Use current axis values to find stick angle.
-        angle2 = atan2(axisX->getCurrentRawValue(), -axisY->getCurrentRawValue());
         axis1Value = axisX->getCurrentRawValue();
         axis2Value = axisY->getCurrentRawValue();
     }
 
-    double ang_sin = sin(angle2);
-    double ang_cos = cos(angle2);
+    PolarState state = getPolarState(axis1Value, axis2Value);
 
-    int deadX = abs(floor(deadZone * ang_sin + 0.5));
+    int deadX = abs(floor(deadZone * state.angleSin + 0.5));
     double diagonalDeadX = calculateXDiagonalDeadZone(axis1Value, axis2Value);
-
-    double squareStickFullPhi = qMin(ang_sin != 0.0 ? 1 / fabs(ang_sin) : 2, ang_cos != 0.0 ? 1 / fabs(ang_cos) : 2);
-    double circle = this->circle;
-    double circleStickFull = (squareStickFullPhi - 1) * circle + 1;
+    double circleStickFull = state.circleStickFull;
 
     double adjustedDeadXZone = circleStickFull > 1.0 ? (deadX / circleStickFull) : deadX;
     double finalDeadZoneX = adjustedDeadXZone - diagonalDeadX;
@@ -3795,7 +3761,6 @@ double JoyControlStick::getSpringDeadCircleX()
 double JoyControlStick::getSpringDeadCircleY()
 {
     double result = 0.0;
-    double angle2 = 0.0;
     int axis1Value = 0;
     int axis2Value = 0;
 
@@ -3803,26 +3768,20 @@ double JoyControlStick::getSpringDeadCircleY()
     {
         // Stick moved back to absolute center. Use previously available values
         // to find stick angle.
-        angle2 = atan2(axisX->getLastKnownRawValue(), -axisY->getLastKnownRawValue());
         axis1Value = axisX->getLastKnownRawValue();
         axis2Value = axisY->getLastKnownRawValue();
     } else
     {
         // Use current axis values to find stick angle.
-        angle2 = atan2(axisX->getCurrentRawValue(), -axisY->getCurrentRawValue());
         axis1Value = axisX->getCurrentRawValue();
         axis2Value = axisY->getCurrentRawValue();
     }
 
-    double ang_sin = sin(angle2);
-    double ang_cos = cos(angle2);
+    PolarState state = getPolarState(axis1Value, axis2Value);
 
-    int deadY = abs(floor(deadZone * ang_cos + 0.5));
+    int deadY = abs(floor(deadZone * state.angleCos + 0.5));
     double diagonalDeadY = calculateYDiagonalDeadZone(axis1Value, axis2Value);
-
-    double squareStickFullPhi = qMin(ang_sin != 0.0 ? 1 / fabs(ang_sin) : 2, ang_cos != 0.0 ? 1 / fabs(ang_cos) : 2);
-    double circle = this->circle;
-    double circleStickFull = (squareStickFullPhi - 1) * circle + 1;
+    double circleStickFull = state.circleStickFull;
 
     double adjustedDeadYZone = (circleStickFull > 1.0) ? (deadY / circleStickFull) : deadY;
     double finalDeadZoneY = adjustedDeadYZone - diagonalDeadY;
@@ -27,7 +27,7 @@
 class JoyAxis;
 class JoyControlStickButton;
 class JoyControlStickModifierButton;
-class QXmlStreamReader;
+class ProfileReader;
 class QXmlStreamWriter;
 
 /**
@@ -183,7 +183,7 @@ class JoyControlStick : public QObject, public JoyStickDirectionsType
     virtual bool isDefault();
     virtual void setDefaultStickName(QString tempname);
     virtual QString getDefaultStickName();
-    virtual void readConfig(QXmlStreamReader *xml);  // JoyControlStickXml class
+    virtual void readConfig(ProfileReader *xml);     // JoyControlStickXml class
     virtual void writeConfig(QXmlStreamWriter *xml); // JoyControlStickXml class
 
     static const JoyMode DEFAULTMODE;
@@ -308,7 +308,37 @@ class JoyControlStick : public QObject, public JoyStickDirectionsType
     QHash<JoyStickDirections, JoyControlStickButton *> buttons;
     JoyControlStickModifierButton *modifierButton;
 
+    /**
+     * @brief Polar coordinates of one stick position. All bearing and
+     *  distance calculations of a sample share them instead of evaluating
+     *  the trigonometric functions again.
+     */
+    struct PolarState
+    {
+        int axisXValue;
+        int axisYValue;
+        double circle;
+        // Result of atan2(x, -y) in radians.
+        double angle;
+        double angleSin;
+        double angleCos;
+        // Raw radial distance.
+        double distance;
+        // Distance to the outer square, reduced by the circle adjustment.
+        double circleStickFull;
+    };
+
+    PolarState m_polar_state;
+    bool m_polar_state_valid = false;
+
+    // Zone boundaries in the order returned by getDiagonalZoneAngles.
+    double m_diagonal_zone_angles[9];
+    static const int FOUR_WAY_CARDINAL_ZONE_ANGLES[4];
+    static const int FOUR_WAY_DIAGONAL_ZONE_ANGLES[4];
+
     void populateStickBtns();
+    PolarState getPolarState(int axisXValue, int axisYValue);
+    void rebuildDiagonalZoneAngles();
 };
 
 #endif // JOYCONTROLSTICK_H
@@ -20,9 +20,9 @@
 #include "joysensor.h"
 #include "inputdevice.h"
 #include "joybuttontypes/joysensorbutton.h"
+#include "profilereader.h"
 #include "xml/joybuttonxml.h"
 
-#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 #include <cmath>
 
@@ -55,6 +55,7 @@ void JoySensor::joyEvent(float *values, bool ignoresets)
     m_current_value[0] = values[0];
     m_current_value[1] = values[1];
     m_current_value[2] = values[2];
+    m_parent_set->getInputDevice()->getStateSnapshot().setSensor(m_type, m_current_value);
 
     JoySensorDirection pending_direction = calculateSensorDirection();
 
@@ -677,9 +678,9 @@ void JoySensor::establishPropertyUpdatedConnection()
 /**
  * @brief Take a XML stream and set the sensor and direction button properties
  *     according to the values contained within the stream.
- * @param QXmlStreamReader instance that will be used to read property values.
+ * @param ProfileReader instance that will be used to read property values.
  */
-void JoySensor::readConfig(QXmlStreamReader *xml)
+void JoySensor::readConfig(ProfileReader *xml)
 {
     if (xml->isStartElement() && (xml->name() == "sensor"))
     {
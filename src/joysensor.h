@@ -27,7 +27,7 @@
 
 class SetJoystick;
 class JoySensorButton;
-class QXmlStreamReader;
+class ProfileReader;
 class QXmlStreamWriter;
 
 /**
@@ -96,7 +96,7 @@ class JoySensor : public QObject
     JoySensorButton *getDirectionButton(JoySensorDirection direction);
 
     bool isDefault() const;
-    void readConfig(QXmlStreamReader *xml);
+    void readConfig(ProfileReader *xml);
     void writeConfig(QXmlStreamWriter *xml) const;
 
     SetJoystick *getParentSet() const;
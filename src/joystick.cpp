@@ -41,6 +41,7 @@ Joystick::Joystick(SDL_Joystick *joyhandle, int deviceIndex, AntiMicroSettings *
         getJoystick_sets().insert(i, setstick);
         enableSetConnections(setstick);
     }
+    initStateSnapshot();
     INFO() << "Created new Joystick:\n" << getDescription();
 }
 
@@ -23,10 +23,10 @@
 #include <QMetaObject>
 #include <QTime>
 
-#include <chrono>
-#include <thread>
+#include <cstring>
 
 Logger *Logger::instance = nullptr;
+std::atomic<int> Logger::enabledLevel(Logger::LOG_NONE);
 
 /**
  * @brief Outputs log messages to a given text stream. Client code
@@ -38,13 +38,20 @@ Logger *Logger::instance = nullptr;
  */
 Logger::Logger(QTextStream *stream, LogLevel output_lvl, QObject *parent)
     : QObject(parent)
+    , records(new LogRecord[QUEUESIZE])
+    , enqueuePosition(0)
+    , dequeuePosition(0)
+    , drainPending(false)
+    , droppedMessages(0)
 {
-    // needed to allow sending LogLevel using signals and slots
-    qRegisterMetaType<Logger::LogLevel>("Logger::LogLevel");
+    for (int i = 0; i < QUEUESIZE; i++)
+        records[i].sequence.store(i, std::memory_order_relaxed);
+
     loggingThread = new QThread(this);
     loggingThread->setObjectName("loggingThread");
     outputStream = stream;
     outputLevel = output_lvl;
+    enabledLevel.store(output_lvl, std::memory_order_relaxed);
 
     this->moveToThread(loggingThread);
     loggingThread->start();
@@ -57,9 +64,15 @@ Logger::~Logger()
 {
     VERBOSE() << "Closing logger";
     // To be sure about proper processing logs before deleting logger
-    std::this_thread::sleep_for(std::chrono::milliseconds(30));
     loggingThread->quit();
     loggingThread->wait();
+    enabledLevel.store(LOG_NONE, std::memory_order_relaxed);
+
+    {
+        QMutexLocker locker(&logMutex);
+        writePendingRecords();
+    }
+
     closeLogger();
     instance = nullptr;
 }
@@ -77,6 +90,7 @@ void Logger::setLogLevel(LogLevel level)
     Q_UNUSED(locker);
 
     instance->outputLevel = level;
+    enabledLevel.store(level, std::memory_order_relaxed);
 }
 
 /**
@@ -129,40 +143,129 @@ void Logger::closeLogger(bool closeStream)
 }
 
 /**
- * @brief Write an individual message to the text stream.
- *
- * This socket method is executed in separate logging thread
+ * @brief Queues a message for the logging thread. This never blocks and
+ *  the message is moved into the queue without copying it.
+ * @param[in,out] message Text of the message. Its contents are moved into
+ *  the queue and it is left empty.
+ * @returns False if the queue was full and the message was dropped.
+ */
+bool Logger::enqueueMessage(QString &message, LogLevel level, uint lineno, const char *filename)
+{
+    LogRecord *record = nullptr;
+    quint64 position = enqueuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        record = &records[position & (QUEUESIZE - 1)];
+        quint64 sequence = record->sequence.load(std::memory_order_acquire);
+        qint64 diff = static_cast<qint64>(sequence - position);
+
+        if (diff == 0)
+        {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0)
+        {
+            droppedMessages.fetch_add(1, std::memory_order_relaxed);
+            requestDrain();
+            return false;
+        } else
+        {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->message.swap(message);
+    record->time = QTime::currentTime();
+    record->filename = filename;
+    record->lineno = lineno;
+    record->level = level;
+    record->sequence.store(position + 1, std::memory_order_release);
+    requestDrain();
+    return true;
+}
+
+/**
+ * @brief Asks the logging thread to write the queued messages. Dropped
+ *  messages request a drain as well, so their count is written once the
+ *  queue drained even if no further message follows.
+ */
+void Logger::requestDrain()
+{
+    // Only one drain request is posted for a burst of messages.
+    if (!drainPending.exchange(true, std::memory_order_acq_rel))
+        QMetaObject::invokeMethod(this, "drainMessages", Qt::QueuedConnection);
+}
+
+/**
+ * @brief Writes all queued messages. This slot is executed in the logging thread.
  */
-void Logger::logMessage(const QString &message, const Logger::LogLevel level, const uint lineno, const QString &filename)
+void Logger::drainMessages()
+{
+    drainPending.store(false, std::memory_order_release);
+
+    QMutexLocker locker(&logMutex);
+    Q_UNUSED(locker);
+
+    writePendingRecords();
+}
+
+/**
+ * @brief Write all published messages of the queue to the text stream.
+ *  logMutex has to be locked by the caller.
+ */
+void Logger::writePendingRecords()
 {
     const static QMap<Logger::LogLevel, QString> TYPE_NAMES = {
         {LogLevel::LOG_DEBUG, "🐞DEBUG"},  {LogLevel::LOG_VERBOSE, "⚪VERBOSE"}, {LogLevel::LOG_INFO, "🟢INFO"},
         {LogLevel::LOG_WARNING, "❗WARN"}, {LogLevel::LOG_ERROR, "❌ERROR"},     {LogLevel::LOG_NONE, "NONE"}};
-    QString displayTime = QString("[%1] ").arg(QTime::currentTime().toString("hh:mm:ss.zzz"));
-    if ((outputLevel != LOG_NONE) && (level <= outputLevel))
+
+    bool written = false;
+    bool enabled = (outputStream != nullptr) && (outputLevel != LOG_NONE);
+    bool extendedLogs = (outputLevel == LOG_DEBUG);
+
+    while (true)
     {
-        bool extendedLogs = (outputLevel == LOG_DEBUG);
-        if (extendedLogs)
-            *outputStream << displayTime;
+        LogRecord &record = records[dequeuePosition & (QUEUESIZE - 1)];
+        if (record.sequence.load(std::memory_order_acquire) != dequeuePosition + 1)
+            break;
 
-        QString finalMessage = message;
-        finalMessage = finalMessage.replace("\n", "\n\t\t\t");
-        *outputStream << TYPE_NAMES[level] << "\t" << finalMessage;
+        QString message = std::move(record.message);
 
-        if (extendedLogs)
+        if (enabled && (record.level <= outputLevel))
         {
-            static int filename_offset = -1;
-            if (filename_offset < 0)
+            if (extendedLogs)
+                *outputStream << QString("[%1] ").arg(record.time.toString("hh:mm:ss.zzz"));
+
+            message.replace("\n", "\n\t\t\t");
+            *outputStream << TYPE_NAMES[record.level] << "\t" << message;
+
+            if (extendedLogs && (record.lineno != 0) && (record.filename != nullptr))
             {
-                filename_offset = filename.lastIndexOf("/src/");
+                const char *shortFilename = strstr(record.filename, "/src/");
+                if (shortFilename == nullptr)
+                    shortFilename = record.filename;
+
+                *outputStream << " (file " << shortFilename << ":" << record.lineno << ")";
             }
-            if (lineno != 0)
-                *outputStream << " (file " << filename.mid(filename_offset) << ":" << lineno << ")";
+
+            *outputStream << "\n";
+            written = true;
         }
 
-        *outputStream << "\n";
-        outputStream->flush();
+        record.sequence.store(dequeuePosition + QUEUESIZE, std::memory_order_release);
+        dequeuePosition++;
+    }
+
+    int dropped = droppedMessages.exchange(0, std::memory_order_relaxed);
+    if (enabled && (dropped > 0))
+    {
+        *outputStream << TYPE_NAMES[LOG_WARNING] << "\t" << dropped << " log messages were dropped\n";
+        written = true;
     }
+
+    if (written)
+        outputStream->flush();
 }
 
 void Logger::setCurrentLogFile(QString filename)
@@ -226,7 +329,13 @@ void Logger::loggerMessageHandler(QtMsgType type, const QMessageLogContext &cont
             break;
         case QtFatalMsg:
             if (level >= Logger::LOG_ERROR)
+            {
                 LogHelper(LogLevel::LOG_ERROR, context.line, context.file, msg);
+
+                QMutexLocker locker(&Logger::instance->logMutex);
+                Q_UNUSED(locker);
+                Logger::instance->writePendingRecords();
+            }
             abort();
         default:
             break;
@@ -20,13 +20,17 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include <QDebug>
 #include <QFile>
 #include <QMutex>
 #include <QObject>
+#include <QScopedArrayPointer>
 #include <QStringRef>
 #include <QTextStream>
 #include <QThread>
+#include <QTime>
 
+#include <atomic>
 #include <sstream>
 
 /**
@@ -44,6 +48,24 @@
 #define INFO() LogHelper(Logger::LogLevel::LOG_INFO, __LINE__, __FILE__)
 #define WARN() LogHelper(Logger::LogLevel::LOG_WARNING, __LINE__, __FILE__)
 #define ERROR() LogHelper(Logger::LogLevel::LOG_ERROR, __LINE__, __FILE__)
+
+/**
+ * @brief Macro used for debug messages in code paths running on every input event
+ *
+ * Unlike DEBUG() or qDebug(), neither the message nor its arguments are
+ * evaluated unless debug logging is enabled, so a disabled trace only costs
+ * a single branch. Building with WITH_TRACE_LOGS=OFF removes them entirely.
+ *
+ * Example usage
+ * TRACE() << "my message" << value;
+ *
+ */
+#ifdef ANTIMICROX_NO_TRACE_LOGS
+    #define TRACE() if (true) {} else qDebug()
+#else
+    #define TRACE() if (Q_LIKELY(!Logger::isTraceEnabled())) {} else qDebug()
+#endif
+
 /**
  * @brief Custom singleton class used for logging across application.
  *
@@ -54,6 +76,10 @@
  * QT macros:
  * qDebug(), qInfo(), qWarning(), qCritical, and qFatal()
  *
+ * Messages are handed to the logging thread through a bounded lock-free
+ * queue, so logging threads never wait for the output stream. When the queue
+ * is full, messages are dropped and their amount is reported later.
+ *
  */
 class Logger : public QObject
 {
@@ -80,6 +106,20 @@ class Logger : public QObject
     LogLevel getCurrentLogLevel();
     static bool isDebugEnabled();
 
+    /**
+     * @brief Lock-free check used by the TRACE() macro.
+     */
+    inline static bool isTraceEnabled() { return enabledLevel.load(std::memory_order_relaxed) == LOG_DEBUG; }
+
+    /**
+     * @brief Lock-free check whether messages of the given level are written.
+     */
+    inline static bool isLevelEnabled(LogLevel level)
+    {
+        int current = enabledLevel.load(std::memory_order_relaxed);
+        return (current != LOG_NONE) && (level <= current);
+    }
+
     static void setCurrentStream(QTextStream *stream);
     static void setCurrentLogFile(QString filename);
     static QString getCurrentLogFile();
@@ -103,51 +143,79 @@ class Logger : public QObject
 
     static Logger *createInstance(QTextStream *stream = nullptr, LogLevel outputLevel = LOG_INFO, QObject *parent = nullptr);
 
+    bool enqueueMessage(QString &message, LogLevel level, uint lineno, const char *filename);
+
   protected:
     explicit Logger(QTextStream *stream, LogLevel output_lvl = LOG_INFO, QObject *parent = nullptr);
     void closeLogger(bool closeStream = true);
+    void writePendingRecords();
+    void requestDrain();
+
+    /**
+     * @brief Single slot of the message queue.
+     *
+     * The sequence number tells producers and the logging thread whether
+     * the slot is free or holds a published message for the current lap.
+     */
+    struct LogRecord
+    {
+        std::atomic<quint64> sequence;
+        QString message;
+        QTime time;
+        const char *filename;
+        uint lineno;
+        LogLevel level;
+    };
+
+    // Must be a power of two.
+    static const int QUEUESIZE = 1024;
 
     static Logger *instance;
+    static std::atomic<int> enabledLevel;
 
     QFile outputFile;
     QTextStream outFileStream;
     QTextStream *outputStream;
 
     LogLevel outputLevel;
-    QMutex logMutex;
+    QMutex logMutex; // serializes writes to outputStream, never taken by producers
     QThread *loggingThread; // in this thread all of writing operations will be executed
 
-  public slots:
-    void logMessage(const QString &message, const Logger::LogLevel level, const uint lineno, const QString &filename);
+    QScopedArrayPointer<LogRecord> records;
+    std::atomic<quint64> enqueuePosition;
+    quint64 dequeuePosition; // protected by logMutex
+    std::atomic<bool> drainPending;
+    std::atomic<int> droppedMessages;
+
+  private slots:
+    void drainMessages();
 };
 
 /**
  * @brief simple helper class used for constructing log message and sending it to Logger
  *
  * Message is sent either by using sendMessage(), or during destruction.
+ * If the level of the message is disabled, nothing is formatted or sent.
  */
-class LogHelper : public QObject
+class LogHelper
 {
-    Q_OBJECT
   public:
     QString message;
     Logger::LogLevel level;
     uint lineno;
-    QString filename;
+    const char *filename;
     bool is_message_sent;
-    Logger::LogLevel log_level;
+    bool enabled;
 
-    LogHelper(const Logger::LogLevel level, const uint lineno, const QString &filename, const QString &message = "")
+    LogHelper(const Logger::LogLevel level, const uint lineno, const char *filename, const QString &message = QString())
         : message(message)
         , level(level)
         , lineno(lineno)
         , filename(filename)
         , is_message_sent(false)
+        , enabled(Logger::isLevelEnabled(level))
     {
-        Logger *pointer = Logger::getInstance();
-        log_level = pointer->getCurrentLogLevel();
-        connect(this, &LogHelper::logMessage, pointer, &Logger::logMessage);
-    };
+    }
 
     ~LogHelper()
     {
@@ -158,34 +226,41 @@ class LogHelper : public QObject
     void sendMessage()
     {
         is_message_sent = true;
-        emit logMessage(message, level, lineno, filename);
+
+        Logger *pointer = Logger::getInstance(false);
+        if (enabled && (pointer != nullptr))
+            pointer->enqueueMessage(message, level, lineno, filename);
     };
 
     LogHelper &operator<<(const QString &s)
     {
-        if (log_level != Logger::LogLevel::LOG_NONE)
-            message = message + s;
+        if (enabled)
+            message += s;
         return *this;
     };
     LogHelper &operator<<(const QStringRef &s)
     {
-        if (log_level != Logger::LogLevel::LOG_NONE)
-            message = message + s;
+        if (enabled)
+            message += s;
+        return *this;
+    };
+    LogHelper &operator<<(const char *s)
+    {
+        if (enabled)
+            message += QString::fromUtf8(s);
         return *this;
     };
     template <typename Message> LogHelper &operator<<(Message ch)
     {
-        if (log_level != Logger::LogLevel::LOG_NONE)
+        if (enabled)
         {
             // The simplest way of building string from possible variables
             std::stringstream str;
             str << ch;
-            message = message + str.str().c_str();
+            message += QString::fromStdString(str.str());
         }
         return *this;
     }
-  signals:
-    void logMessage(const QString &message, const Logger::LogLevel level, const uint lineno, const QString &filename);
 };
 
 /**
@@ -201,10 +276,10 @@ class StreamPrinter : public QObject
     QTextStream m_stream;
     std::stringstream m_message;
     uint m_lineno;
-    QString m_filename;
+    const char *m_filename;
 
   public:
-    StreamPrinter(FILE *file, uint lineno = 0, QString filename = "")
+    StreamPrinter(FILE *file, uint lineno = 0, const char *filename = "")
         : m_stream(file)
         , m_message("")
         , m_lineno(lineno)
@@ -22,13 +22,18 @@
 #include "autoprofileinfo.h"
 #include "commandlineutility.h"
 #include "common.h"
+#include "headlessprofilemanager.h"
 #include "inputdaemon.h"
 #include "inputdevice.h"
 #include "joybuttonslot.h"
+#include "joybuttontypes/joybutton.h"
 #include "joysensordirection.h"
 #include "joysensortype.h"
 #include "localantimicroserver.h"
 #include "mainwindow.h"
+#include "profilecache.h"
+#include "profilereader.h"
+#include "profilesaver.h"
 #include "setjoystick.h"
 #include "simplekeygrabberbutton.h"
 
@@ -46,6 +51,7 @@
 #include <QMapIterator>
 #include <QMessageBox>
 #include <QPointer>
+#include <QScopedPointer>
 #include <QSettings>
 #include <QStandardPaths>
 #include <QTextStream>
@@ -171,8 +177,9 @@ static void deleteInputDevices(QMap<SDL_JoystickID, InputDevice *> *joysticks)
 /**
  * @brief Function used for copying settings used by antimicro and
  * previous revisions of antimicrox to provide backward compatibility
+ * @param[in] graphical Inform the user with a message box instead of the log.
  */
-void importLegacySettingsIfExist()
+void importLegacySettingsIfExist(bool graphical)
 {
     qDebug() << "Importing settings";
     const QFileInfo config(PadderCommon::configFilePath());
@@ -206,18 +213,21 @@ void importLegacySettingsIfExist()
                         "antimicrox_settings.ini.")
                 .arg(fileToCopy.canonicalFilePath(), location);
 
-        QMessageBox msgBox;
         if (copySuccess)
-        {
             qDebug() << "Legacy settings copied";
-            msgBox.setText(successMessage);
-        } else
-        {
+        else
             qWarning() << "Problem with importing settings from: " << fileToCopy.canonicalFilePath()
                        << " to: " << PadderCommon::configFilePath();
-            msgBox.setText(errorMessage);
+
+        if (graphical)
+        {
+            QMessageBox msgBox;
+            msgBox.setText(copySuccess ? successMessage : errorMessage);
+            msgBox.exec();
+        } else
+        {
+            qInfo() << (copySuccess ? successMessage : errorMessage);
         }
-        msgBox.exec();
     }
 }
 
@@ -225,7 +235,11 @@ int main(int argc, char *argv[])
 {
     qInstallMessageHandler(Logger::loggerMessageHandler);
 
-    QApplication antimicrox(argc, argv);
+    // Headless mode only creates a QCoreApplication so neither a display
+    // connection nor any widget is required.
+    const bool headless = CommandLineUtility::hasHeadlessArgument(argc, argv);
+    QScopedPointer<QCoreApplication> antimicrox(headless ? new QCoreApplication(argc, argv)
+                                                         : new QApplication(argc, argv));
     QCoreApplication::setApplicationName("antimicrox");
     QCoreApplication::setApplicationVersion(PadderCommon::programVersion);
 
@@ -241,22 +255,24 @@ int main(int argc, char *argv[])
     qRegisterMetaType<JoyButtonSlot::JoySlotInputAction>("JoyButtonSlot::JoySlotInputAction");
     qRegisterMetaType<JoySensorType>();
     qRegisterMetaType<JoySensorDirection>();
+    qRegisterMetaType<ProfileReader *>();
 
 #if defined(WITH_X11)
 
-    if (QApplication::platformName() == QStringLiteral("xcb"))
+    // The XTest event handler still opens a display in headless mode.
+    if (headless || (QApplication::platformName() == QStringLiteral("xcb")))
     {
         XInitThreads();
     }
 
 #endif
-    importLegacySettingsIfExist();
+    importLegacySettingsIfExist(!headless);
     AntiMicroSettings settings(PadderCommon::configFilePath(), QSettings::IniFormat);
     CommandLineUtility cmdutility;
 
     try
     {
-        cmdutility.parseArguments(antimicrox);
+        cmdutility.parseArguments(*antimicrox);
     } catch (const std::runtime_error &e)
     {
         std::cerr << e.what() << '\n';
@@ -275,6 +291,20 @@ int main(int argc, char *argv[])
         configDir.mkpath(PadderCommon::configPath());
     }
 
+    if (cmdutility.shouldBenchmarkProfile())
+    {
+        int result = ProfileCache::getInstance()->benchmark(cmdutility.getBenchmarkProfileLocation(), 100);
+        delete appLogger;
+        return result;
+    }
+
+    if (cmdutility.shouldBenchmarkMouseCurves())
+    {
+        int result = JoyButton::benchmarkMouseCurves(1000000);
+        delete appLogger;
+        return result;
+    }
+
     QMap<SDL_JoystickID, InputDevice *> *joysticks = new QMap<SDL_JoystickID, InputDevice *>();
     QThread *inputEventThread = nullptr;
 
@@ -319,18 +349,40 @@ int main(int argc, char *argv[])
         // Save app config and exit.
         PRINT_STDOUT() << "AntiMicroX is already running.\n";
         QPointer<InputDaemon> joypad_worker = new InputDaemon(joysticks, &settings, false);
-        MainWindow mainWindow(joysticks, &cmdutility, &settings, false);
-        mainWindow.fillButtons();
-        mainWindow.alterConfigFromSettings();
 
-        if (cmdutility.hasProfile() || cmdutility.hasProfileInOptions())
+        if (headless)
         {
-            PRINT_STDOUT() << "Update selected profile\n";
-            mainWindow.saveAppConfig();
-        } else if (cmdutility.isUnloadRequested())
+            HeadlessProfileManager profileManager(joysticks, &cmdutility, &settings, false);
+            profileManager.fillDevices();
+            profileManager.alterConfigFromSettings();
+
+            if (cmdutility.hasProfile() || cmdutility.hasProfileInOptions())
+            {
+                PRINT_STDOUT() << "Update selected profile\n";
+                profileManager.saveAppConfig();
+            } else if (cmdutility.isUnloadRequested())
+            {
+                profileManager.saveAppConfig();
+            }
+        } else
         {
-            mainWindow.saveAppConfig();
-        } else if (cmdutility.isShowRequested())
+            MainWindow mainWindow(joysticks, &cmdutility, &settings, false);
+            mainWindow.fillButtons();
+            mainWindow.alterConfigFromSettings();
+
+            if (cmdutility.hasProfile() || cmdutility.hasProfileInOptions())
+            {
+                PRINT_STDOUT() << "Update selected profile\n";
+                mainWindow.saveAppConfig();
+            } else if (cmdutility.isUnloadRequested())
+            {
+                mainWindow.saveAppConfig();
+            }
+
+            mainWindow.removeJoyTabs();
+        }
+
+        if (cmdutility.isShowRequested())
         {
             INFO() << "Showing window if hidden.\n";
             socket.write(PadderCommon::unhideCommand.toStdString().c_str());
@@ -338,16 +390,15 @@ int main(int argc, char *argv[])
         }
         qDebug() << "Closing this app instance";
 
-        mainWindow.removeJoyTabs();
-        QObject::connect(&antimicrox, &QApplication::aboutToQuit, joypad_worker.data(), &InputDaemon::quit);
+        QObject::connect(antimicrox.data(), &QCoreApplication::aboutToQuit, joypad_worker.data(), &InputDaemon::quit);
 
 #if QT_VERSION >= QT_VERSION_CHECK(5, 4, 0)
-        QTimer::singleShot(50, &antimicrox, &QApplication::quit);
+        QTimer::singleShot(50, antimicrox.data(), &QCoreApplication::quit);
 #else
-        QTimer::singleShot(50, &antimicrox, SLOT(quit()));
+        QTimer::singleShot(50, antimicrox.data(), SLOT(quit()));
 #endif
 
-        int result = antimicrox.exec();
+        int result = antimicrox->exec();
 
         settings.sync();
         socket.disconnectFromServer();
@@ -375,24 +426,27 @@ int main(int argc, char *argv[])
     LocalAntiMicroServer *localServer = new LocalAntiMicroServer();
     localServer->startLocalServer();
 
+    if (!headless)
+    {
 #if defined(Q_OS_WIN)
-    qApp->setStyle("fusion");
+        QApplication::setStyle("fusion");
 #endif
 
-    antimicrox.setQuitOnLastWindowClosed(false);
+        QApplication::setQuitOnLastWindowClosed(false);
 
-    QStringList appDirsLocations = QStandardPaths::standardLocations(QStandardPaths::AppLocalDataLocation);
-    appDirsLocations.append(QStandardPaths::standardLocations(QStandardPaths::GenericDataLocation));
-    QStringList themePathsTries = QStringList();
+        QStringList appDirsLocations = QStandardPaths::standardLocations(QStandardPaths::AppLocalDataLocation);
+        appDirsLocations.append(QStandardPaths::standardLocations(QStandardPaths::GenericDataLocation));
+        QStringList themePathsTries = QStringList();
 
-    for (QList<QString>::const_iterator i = appDirsLocations.constBegin(); i != appDirsLocations.constEnd(); ++i)
-    {
-        themePathsTries.append(QString("%1%2").arg(*i).arg("/icons"));
-        qDebug() << QString("%1%2").arg(*i).arg("/icons");
-    }
+        for (QList<QString>::const_iterator i = appDirsLocations.constBegin(); i != appDirsLocations.constEnd(); ++i)
+        {
+            themePathsTries.append(QString("%1%2").arg(*i).arg("/icons"));
+            qDebug() << QString("%1%2").arg(*i).arg("/icons");
+        }
 
-    QIcon::setThemeSearchPaths(themePathsTries);
-    qDebug() << "Theme name: " << QIcon::themeName();
+        QIcon::setThemeSearchPaths(themePathsTries);
+        qDebug() << "Theme name: " << QIcon::themeName();
+    }
 
     // Update log info based on config values
     if (cmdutility.getCurrentLogLevel() == Logger::LOG_NONE && settings.contains("LogLevel"))
@@ -428,7 +482,7 @@ int main(int argc, char *argv[])
     }
 
 #endif
-    antimicrox.installTranslator(&qtTranslator);
+    antimicrox->installTranslator(&qtTranslator);
 
     QTranslator myappTranslator;
 
@@ -441,7 +495,7 @@ int main(int argc, char *argv[])
                              QApplication::applicationDirPath().append("/../share/antimicrox/translations"));
     }
 
-    antimicrox.installTranslator(&myappTranslator);
+    antimicrox->installTranslator(&myappTranslator);
 
     if (cmdutility.shouldListControllers())
     {
@@ -552,38 +606,71 @@ int main(int argc, char *argv[])
     inputEventThread = new QThread();
     inputEventThread->setObjectName("inputEventThread");
 
-    MainWindow *mainWindow = new MainWindow(joysticks, &cmdutility, &settings);
+    MainWindow *mainWindow = nullptr;
+    HeadlessProfileManager *profileManager = nullptr;
+
+    if (headless)
+        profileManager = new HeadlessProfileManager(joysticks, &cmdutility, &settings);
+    else
+        mainWindow = new MainWindow(joysticks, &cmdutility, &settings);
+
+    AppLaunchHelper mainAppHelper(&settings, !headless && mainWindow->getGraphicalStatus(), headless);
 
-    mainWindow->setAppTranslator(&qtTranslator);
-    mainWindow->setTranslator(&myappTranslator);
+    QObject::connect(antimicrox.data(), &QCoreApplication::aboutToQuit, localServer, &LocalAntiMicroServer::close);
 
-    AppLaunchHelper mainAppHelper(&settings, mainWindow->getGraphicalStatus());
+    if (headless)
+    {
+        QObject::connect(joypad_worker.data(), &InputDaemon::joysticksRefreshed, profileManager,
+                         &HeadlessProfileManager::fillDevicesMap);
+        QObject::connect(antimicrox.data(), &QCoreApplication::aboutToQuit, profileManager,
+                         &HeadlessProfileManager::saveAppConfig);
+        QObject::connect(localServer, &LocalAntiMicroServer::clientdisconnect, profileManager,
+                         &HeadlessProfileManager::handleInstanceDisconnect);
+        QObject::connect(joypad_worker.data(), &InputDaemon::deviceRemoved, profileManager,
+                         &HeadlessProfileManager::removeDevice);
+        QObject::connect(joypad_worker.data(), &InputDaemon::deviceAdded, profileManager,
+                         &HeadlessProfileManager::addDevice);
+    } else
+    {
+        mainWindow->setAppTranslator(&qtTranslator);
+        mainWindow->setTranslator(&myappTranslator);
 
-    QObject::connect(mainWindow, &MainWindow::joystickRefreshRequested, joypad_worker.data(), &InputDaemon::refresh);
-    QObject::connect(joypad_worker.data(), &InputDaemon::joystickRefreshed, mainWindow, &MainWindow::fillButtonsID);
-    QObject::connect(joypad_worker.data(), &InputDaemon::joysticksRefreshed, mainWindow, &MainWindow::fillButtonsMap);
+        QObject::connect(mainWindow, &MainWindow::joystickRefreshRequested, joypad_worker.data(), &InputDaemon::refresh);
+        QObject::connect(joypad_worker.data(), &InputDaemon::joystickRefreshed, mainWindow, &MainWindow::fillButtonsID);
+        QObject::connect(joypad_worker.data(), &InputDaemon::joysticksRefreshed, mainWindow, &MainWindow::fillButtonsMap);
 
-    QObject::connect(&antimicrox, &QApplication::aboutToQuit, localServer, &LocalAntiMicroServer::close);
-    QObject::connect(&antimicrox, &QApplication::aboutToQuit, mainWindow, &MainWindow::saveAppConfig);
-    QObject::connect(&antimicrox, &QApplication::aboutToQuit, mainWindow, &MainWindow::removeJoyTabs);
-    QObject::connect(&antimicrox, &QApplication::aboutToQuit, &mainAppHelper, &AppLaunchHelper::revertMouseThread);
-    QObject::connect(&antimicrox, &QApplication::aboutToQuit, joypad_worker.data(), &InputDaemon::quit);
-    QObject::connect(&antimicrox, &QApplication::aboutToQuit, joypad_worker.data(), &InputDaemon::deleteLater);
+        QObject::connect(antimicrox.data(), &QCoreApplication::aboutToQuit, mainWindow, &MainWindow::saveAppConfig);
+        QObject::connect(antimicrox.data(), &QCoreApplication::aboutToQuit, mainWindow, &MainWindow::removeJoyTabs);
 
-    QObject::connect(localServer, &LocalAntiMicroServer::showHiddenWindow, mainWindow, &MainWindow::show);
-    QObject::connect(localServer, &LocalAntiMicroServer::clientdisconnect, mainWindow,
-                     &MainWindow::handleInstanceDisconnect);
-    QObject::connect(mainWindow, &MainWindow::mappingUpdated, joypad_worker.data(), &InputDaemon::refreshMapping);
-    QObject::connect(joypad_worker.data(), &InputDaemon::deviceUpdated, mainWindow, &MainWindow::testMappingUpdateNow);
+        QObject::connect(localServer, &LocalAntiMicroServer::showHiddenWindow, mainWindow, &MainWindow::show);
+        QObject::connect(localServer, &LocalAntiMicroServer::clientdisconnect, mainWindow,
+                         &MainWindow::handleInstanceDisconnect);
+        QObject::connect(mainWindow, &MainWindow::mappingUpdated, joypad_worker.data(), &InputDaemon::refreshMapping);
+        QObject::connect(joypad_worker.data(), &InputDaemon::deviceUpdated, mainWindow,
+                         &MainWindow::testMappingUpdateNow);
+
+        QObject::connect(joypad_worker.data(), &InputDaemon::deviceRemoved, mainWindow, &MainWindow::removeJoyTab);
+        QObject::connect(joypad_worker.data(), &InputDaemon::deviceAdded, mainWindow, &MainWindow::addJoyTab);
+    }
 
-    QObject::connect(joypad_worker.data(), &InputDaemon::deviceRemoved, mainWindow, &MainWindow::removeJoyTab);
-    QObject::connect(joypad_worker.data(), &InputDaemon::deviceAdded, mainWindow, &MainWindow::addJoyTab);
+    QObject::connect(antimicrox.data(), &QCoreApplication::aboutToQuit, &mainAppHelper,
+                     &AppLaunchHelper::revertMouseThread);
+    QObject::connect(antimicrox.data(), &QCoreApplication::aboutToQuit, joypad_worker.data(), &InputDaemon::quit);
+    QObject::connect(antimicrox.data(), &QCoreApplication::aboutToQuit, joypad_worker.data(),
+                     &InputDaemon::deleteLater);
 
     mainAppHelper.initRunMethods();
 
-    QTimer::singleShot(0, mainWindow, SLOT(fillButtons()));
-    QTimer::singleShot(0, mainWindow, SLOT(alterConfigFromSettings()));
-    QTimer::singleShot(0, mainWindow, SLOT(changeWindowStatus()));
+    if (headless)
+    {
+        QTimer::singleShot(0, profileManager, SLOT(fillDevices()));
+        QTimer::singleShot(0, profileManager, SLOT(alterConfigFromSettings()));
+    } else
+    {
+        QTimer::singleShot(0, mainWindow, SLOT(fillButtons()));
+        QTimer::singleShot(0, mainWindow, SLOT(alterConfigFromSettings()));
+        QTimer::singleShot(0, mainWindow, SLOT(changeWindowStatus()));
+    }
 
     mainAppHelper.changeMouseThread(inputEventThread);
 
@@ -593,9 +680,10 @@ int main(int argc, char *argv[])
     PadderCommon::mouseHelperObj.moveToThread(inputEventThread);
     inputEventThread->start(QThread::HighPriority);
 
-    int app_result = antimicrox.exec();
+    int app_result = antimicrox->exec();
 
     qInfo() << QObject::tr("Quitting Program");
+    ProfileSaver::getInstance()->waitForAll();
 
     delete localServer;
     localServer = nullptr;
@@ -631,6 +719,9 @@ int main(int argc, char *argv[])
     delete mainWindow;
     mainWindow = nullptr;
 
+    delete profileManager;
+    profileManager = nullptr;
+
     delete appLogger;
     return app_result;
 }
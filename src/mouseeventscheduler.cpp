@@ -0,0 +1,325 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mouseeventscheduler.h"
+
+#include "globalvariables.h"
+#include "logger.h"
+
+#include <QMetaObject>
+
+#ifdef Q_OS_LINUX
+    #include <sys/prctl.h>
+#endif
+
+MouseEventScheduler::MouseEventScheduler(QObject *parent)
+    : QObject(parent)
+    , m_quit(false)
+    , m_active(false)
+    , m_idle(true)
+    , m_period_usec(GlobalVariables::JoyButton::DEFAULTIDLEMOUSEREFRESHRATE * 1000)
+    , m_active_period_usec(GlobalVariables::JoyButton::mouseRefreshPeriodUsec)
+    , m_idle_period_usec(GlobalVariables::JoyButton::DEFAULTIDLEMOUSEREFRESHRATE * 1000)
+    , m_generation(0)
+    , m_dispatch_pending(false)
+    , m_dispatch_count(0)
+    , m_max_jitter_usec(0.0)
+    , m_tick_count(0)
+    , m_missed_ticks(0)
+    , m_stats_start(Clock::now())
+{
+}
+
+MouseEventScheduler::~MouseEventScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_cond.notify_all();
+
+    if (m_thread.joinable())
+        m_thread.join();
+}
+
+bool MouseEventScheduler::isActive() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_active;
+}
+
+bool MouseEventScheduler::isIdle() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idle;
+}
+
+/**
+ * @brief Gets the period of the currently running tick sequence.
+ * @returns Current period in microseconds.
+ */
+int MouseEventScheduler::intervalUsec() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_period_usec;
+}
+
+int MouseEventScheduler::activeIntervalUsec() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_active_period_usec;
+}
+
+int MouseEventScheduler::idleIntervalUsec() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idle_period_usec;
+}
+
+/**
+ * @brief Sets the tick period used while mouse events are pending.
+ * @param[in] usec Period in microseconds.
+ */
+void MouseEventScheduler::setActiveIntervalUsec(int usec)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_active_period_usec = usec;
+
+    if (m_active && !m_idle)
+        rearm(usec);
+}
+
+/**
+ * @brief Sets the tick period used while no mouse events are pending.
+ * @param[in] usec Period in microseconds.
+ */
+void MouseEventScheduler::setIdleIntervalUsec(int usec)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_idle_period_usec = usec;
+
+    if (m_active && m_idle)
+        rearm(usec);
+}
+
+/**
+ * @brief Switches between the active and idle tick period.
+ *  A running tick sequence is only re-anchored if its period changes.
+ * @param[in] idle True to use the idle period.
+ * @returns True if the current period was changed.
+ */
+bool MouseEventScheduler::setIdle(bool idle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    int target = idle ? m_idle_period_usec : m_active_period_usec;
+    bool changed = (m_period_usec != target);
+
+    m_idle = idle;
+    if (changed)
+    {
+        if (m_active)
+            rearm(target);
+        else
+            m_period_usec = target;
+    }
+
+    return changed;
+}
+
+/**
+ * @brief Gets the tick rate achieved since the last statistics reset.
+ * @returns Ticks per second.
+ */
+double MouseEventScheduler::getAchievedRate() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    double seconds = std::chrono::duration<double>(Clock::now() - m_stats_start).count();
+    return (seconds > 0.0) ? (m_tick_count / seconds) : 0.0;
+}
+
+/**
+ * @brief Gets the mean latency between the scheduled deadline and the
+ *  dispatch of timeout() in the receiving thread.
+ * @returns Mean jitter in microseconds.
+ */
+double MouseEventScheduler::getMeanJitterUsec() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_jitter_stats.getMean();
+}
+
+double MouseEventScheduler::getMaxJitterUsec() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_max_jitter_usec;
+}
+
+/**
+ * @brief Gets the amount of ticks which were skipped because either the
+ *  clock thread woke up too late or the receiving thread was still busy
+ *  with the previous tick.
+ */
+size_t MouseEventScheduler::getMissedTicks() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_missed_ticks;
+}
+
+/**
+ * @brief Starts ticking with the active or idle period, depending on the
+ *  current idle state.
+ */
+void MouseEventScheduler::start()
+{
+    ensureThread();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    rearm(m_idle ? m_idle_period_usec : m_active_period_usec);
+}
+
+/**
+ * @brief Starts ticking with a temporary period which is kept until the
+ *  next call to setIdle() selects a different one.
+ * @param[in] usec Temporary period in microseconds.
+ */
+void MouseEventScheduler::startBurst(int usec)
+{
+    ensureThread();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    rearm(usec);
+}
+
+void MouseEventScheduler::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_active = false;
+        m_generation++;
+    }
+    m_cond.notify_all();
+}
+
+void MouseEventScheduler::resetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_jitter_stats.reset();
+    m_max_jitter_usec = 0.0;
+    m_tick_count = 0;
+    m_missed_ticks = 0;
+    m_stats_start = Clock::now();
+}
+
+void MouseEventScheduler::dispatchTimeout()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Cleared with the lock held, so the clock thread cannot replace
+        // the deadline before it is read.
+        m_dispatch_pending = false;
+
+        if (!m_active)
+            return;
+
+        // Measured on dispatch, so the latency of the queued call is included.
+        double jitter = std::chrono::duration<double, std::micro>(Clock::now() - m_dispatch_deadline).count();
+        m_jitter_stats.process(jitter);
+        m_max_jitter_usec = qMax(m_max_jitter_usec, jitter);
+        m_tick_count++;
+    }
+
+    emit timeout();
+
+    m_dispatch_count++;
+    if (Logger::isDebugEnabled() &&
+        ((m_dispatch_count % GlobalVariables::MouseEventScheduler::STATISTICSREPORTINTERVAL) == 0))
+    {
+        DEBUG() << "Mouse event ticks: " << getAchievedRate() << " Hz period: " << intervalUsec()
+                << " us jitter mean: " << getMeanJitterUsec() << " us max: " << getMaxJitterUsec()
+                << " us missed ticks: " << getMissedTicks();
+        resetStatistics();
+    }
+}
+
+void MouseEventScheduler::ensureThread()
+{
+    if (!m_thread.joinable())
+        m_thread = std::thread(&MouseEventScheduler::run, this);
+}
+
+/**
+ * @brief Restarts the tick sequence with the given period.
+ *  Must be called with m_mutex held.
+ */
+void MouseEventScheduler::rearm(int usec)
+{
+    int period = qMax(usec, GlobalVariables::MouseEventScheduler::MINIMUMINTERVALUSEC);
+
+    m_period_usec = usec;
+    m_deadline = Clock::now() + std::chrono::microseconds(period);
+    m_active = true;
+    m_generation++;
+    m_cond.notify_all();
+}
+
+void MouseEventScheduler::run()
+{
+#ifdef Q_OS_LINUX
+    // Default timer slack of 50 us would dominate sub-millisecond periods.
+    prctl(PR_SET_TIMERSLACK, 1UL);
+#endif
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_quit)
+    {
+        if (!m_active)
+        {
+            m_cond.wait(lock);
+            continue;
+        }
+
+        unsigned int generation = m_generation;
+        Clock::time_point deadline = m_deadline;
+
+        // Absolute deadlines keep the period free of accumulated drift.
+        if (m_cond.wait_until(lock, deadline, [this, generation] { return m_quit || (m_generation != generation); }))
+            continue;
+
+        Clock::time_point now = Clock::now();
+        std::chrono::microseconds period(qMax(m_period_usec, GlobalVariables::MouseEventScheduler::MINIMUMINTERVALUSEC));
+        m_deadline += period;
+        if (m_deadline <= now)
+        {
+            // Fell behind by more than a period. Skip the lost ticks
+            // instead of bursting to catch up.
+            m_missed_ticks += (now - m_deadline) / period + 1;
+            m_deadline = now + period;
+        }
+
+        if (m_dispatch_pending.exchange(true))
+        {
+            m_missed_ticks++;
+            continue;
+        }
+
+        m_dispatch_deadline = deadline;
+        lock.unlock();
+        QMetaObject::invokeMethod(this, "dispatchTimeout", Qt::QueuedConnection);
+        lock.lock();
+    }
+}
@@ -0,0 +1,104 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "statisticsestimator.h"
+
+#include <QObject>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief High resolution tick source for mouse output.
+ *
+ * A dedicated clock thread sleeps until absolute monotonic deadlines and
+ * posts a queued timeout() to the thread this object lives in, so all
+ * mouse processing stays on the input thread. Periods are given in
+ * microseconds which allows refresh rates above 1000 Hz.
+ * The scheduler knows an active and an idle period and switches between
+ * them on request instead of being restarted by its users.
+ */
+class MouseEventScheduler : public QObject
+{
+    Q_OBJECT
+
+  public:
+    explicit MouseEventScheduler(QObject *parent = nullptr);
+    ~MouseEventScheduler();
+
+    bool isActive() const;
+    bool isIdle() const;
+    int intervalUsec() const;
+    int activeIntervalUsec() const;
+    int idleIntervalUsec() const;
+
+    void setActiveIntervalUsec(int usec);
+    void setIdleIntervalUsec(int usec);
+    bool setIdle(bool idle);
+
+    double getAchievedRate() const;
+    double getMeanJitterUsec() const;
+    double getMaxJitterUsec() const;
+    size_t getMissedTicks() const;
+
+  signals:
+    void timeout();
+
+  public slots:
+    void start();
+    void startBurst(int usec);
+    void stop();
+    void resetStatistics();
+
+  private slots:
+    void dispatchTimeout();
+
+  private:
+    typedef std::chrono::steady_clock Clock;
+
+    void ensureThread();
+    void rearm(int usec);
+    void run();
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::thread m_thread;
+    bool m_quit;
+    bool m_active;
+    bool m_idle;
+    int m_period_usec;
+    int m_active_period_usec;
+    int m_idle_period_usec;
+    Clock::time_point m_deadline;
+    // Incremented on every rearm so the clock thread can drop stale deadlines.
+    unsigned int m_generation;
+    std::atomic<bool> m_dispatch_pending;
+    // Deadline of the tick whose dispatch is pending.
+    Clock::time_point m_dispatch_deadline;
+    // Only touched by the thread this object lives in.
+    size_t m_dispatch_count;
+
+    StatisticsEstimator m_jitter_stats;
+    double m_max_jitter_usec;
+    size_t m_tick_count;
+    size_t m_missed_ticks;
+    Clock::time_point m_stats_start;
+};
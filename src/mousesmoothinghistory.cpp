@@ -0,0 +1,131 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mousesmoothinghistory.h"
+
+MouseSmoothingHistory::MouseSmoothingHistory()
+    : m_weight_modifier(0.0)
+    , m_capacity(0)
+    , m_size(0)
+    , m_head(0)
+{
+    setCapacity(1);
+}
+
+/**
+ * @brief Changes the maximum amount of stored samples and clears the history.
+ * @param[in] capacity New capacity, must be at least one.
+ */
+void MouseSmoothingHistory::setCapacity(int capacity)
+{
+    m_capacity = qMax(1, capacity);
+    m_x.fill(0.0, 2 * m_capacity);
+    m_y.fill(0.0, 2 * m_capacity);
+    clear();
+    rebuildWeights();
+}
+
+/**
+ * @brief Changes the factor applied to the weight of each older sample.
+ * @param[in] modifier Weight modifier in the range of 0.0 - 1.0.
+ */
+void MouseSmoothingHistory::setWeightModifier(double modifier)
+{
+    if (modifier != m_weight_modifier)
+    {
+        m_weight_modifier = modifier;
+        rebuildWeights();
+    }
+}
+
+void MouseSmoothingHistory::clear()
+{
+    m_size = 0;
+    m_head = 0;
+}
+
+/**
+ * @brief Fills the whole history with zero displacements.
+ */
+void MouseSmoothingHistory::fillZero()
+{
+    m_x.fill(0.0);
+    m_y.fill(0.0);
+    m_size = m_capacity;
+}
+
+/**
+ * @brief Adds a new sample and drops the oldest one if the history is full.
+ */
+void MouseSmoothingHistory::push(double x, double y)
+{
+    m_head = (m_head == 0) ? (m_capacity - 1) : (m_head - 1);
+
+    // Mirror into the second half so reads never have to wrap around.
+    m_x[m_head] = m_x[m_head + m_capacity] = x;
+    m_y[m_head] = m_y[m_head + m_capacity] = y;
+
+    if (m_size < m_capacity)
+        m_size++;
+}
+
+/**
+ * @brief Calculates the weighted average of all stored samples.
+ *  The newest sample has a weight of 1.0 and each older one is
+ *  additionally multiplied with the weight modifier.
+ * @param[out] x Weighted average along the X axis.
+ * @param[out] y Weighted average along the Y axis.
+ */
+void MouseSmoothingHistory::weightedAverage(double &x, double &y) const
+{
+    x = 0.0;
+    y = 0.0;
+
+    if (m_size == 0)
+        return;
+
+    const double *weights = m_weights.constData();
+    const double *histX = m_x.constData() + m_head;
+    const double *histY = m_y.constData() + m_head;
+
+    for (int i = 0; i < m_size; i++)
+    {
+        x += histX[i] * weights[i];
+        y += histY[i] * weights[i];
+    }
+
+    double finalWeight = m_weight_sums.at(m_size - 1);
+    x /= finalWeight;
+    y /= finalWeight;
+}
+
+void MouseSmoothingHistory::rebuildWeights()
+{
+    m_weights.resize(m_capacity);
+    m_weight_sums.resize(m_capacity);
+
+    double currentWeight = 1.0;
+    double finalWeight = 0.0;
+
+    for (int i = 0; i < m_capacity; i++)
+    {
+        finalWeight += currentWeight;
+        m_weights[i] = currentWeight;
+        m_weight_sums[i] = finalWeight;
+        currentWeight *= m_weight_modifier;
+    }
+}
@@ -0,0 +1,65 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QVector>
+
+/**
+ * @brief Fixed capacity history of cursor displacements used for mouse smoothing.
+ *
+ * Samples of both axes are kept in ring buffers which are stored twice in a
+ * row so the newest to oldest samples are always contiguous in memory.
+ * The geometric weights and their running sums are precomputed whenever the
+ * capacity or weight modifier changes, so calculating the weighted average
+ * is a plain multiply-add loop without allocations.
+ */
+class MouseSmoothingHistory
+{
+  public:
+    MouseSmoothingHistory();
+
+    void setCapacity(int capacity);
+    void setWeightModifier(double modifier);
+
+    /**
+     * @brief Gets the maximum amount of stored samples.
+     */
+    inline int getCapacity() const { return m_capacity; }
+    /**
+     * @brief Gets the amount of currently stored samples.
+     */
+    inline int getSize() const { return m_size; }
+
+    void clear();
+    void fillZero();
+    void push(double x, double y);
+    void weightedAverage(double &x, double &y) const;
+
+  private:
+    void rebuildWeights();
+
+    QVector<double> m_x;
+    QVector<double> m_y;
+    QVector<double> m_weights;
+    // Sum of the first n + 1 weights at index n.
+    QVector<double> m_weight_sums;
+    double m_weight_modifier;
+    int m_capacity;
+    int m_size;
+    // Index of the newest sample.
+    int m_head;
+};
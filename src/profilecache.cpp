@@ -0,0 +1,235 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profilecache.h"
+
+#include "logger.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QXmlStreamReader>
+#include <QtConcurrent>
+
+#include <cstring>
+#include <limits>
+
+namespace {
+// "AMPC" in little endian byte order.
+const quint32 CACHE_MAGIC = 0x43504d41;
+// Increment whenever the layout of the cache header or ProfileImage changes.
+const quint32 CACHE_VERSION = 1;
+
+struct CacheHeader
+{
+    quint32 magic;
+    quint32 version;
+    qint64 modified;
+    qint64 size;
+    char hash[20];
+    quint32 imageSize;
+};
+
+// Keeps the image data after the header aligned in mapped files.
+static_assert(sizeof(CacheHeader) % 8 == 0, "Cache header size must keep the image aligned");
+
+QByteArray contentHash(const QByteArray &contents) { return QCryptographicHash::hash(contents, QCryptographicHash::Sha1); }
+} // namespace
+
+ProfileCache::ProfileCache()
+    : m_directory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/profiles")
+{
+}
+
+ProfileCache *ProfileCache::getInstance()
+{
+    static ProfileCache cache;
+    return &cache;
+}
+
+/**
+ * @brief Maps the cached image of a profile.
+ * @param[in] contents Current contents of the profile file.
+ * @returns The image or a null pointer if there is no valid cache file
+ *  for this version of the profile.
+ */
+QSharedPointer<const ProfileImage> ProfileCache::load(const QString &fileLocation, const QByteArray &contents)
+{
+    QFileInfo info(fileLocation);
+    QSharedPointer<QFile> file(new QFile(cacheFilePath(fileLocation)));
+
+    if (!info.isFile() || contents.isEmpty() || !file->open(QFile::ReadOnly) ||
+        (file->size() < static_cast<qint64>(sizeof(CacheHeader))))
+        return QSharedPointer<const ProfileImage>();
+
+    const uchar *mapped = file->map(0, file->size());
+
+    if (mapped == nullptr)
+        return QSharedPointer<const ProfileImage>();
+
+    const CacheHeader *header = reinterpret_cast<const CacheHeader *>(mapped);
+    QByteArray hash = contentHash(contents);
+
+    if ((header->magic != CACHE_MAGIC) || (header->version != CACHE_VERSION) ||
+        (header->modified != info.lastModified().toMSecsSinceEpoch()) || (header->size != info.size()) ||
+        (hash.size() != static_cast<int>(sizeof(header->hash))) ||
+        (std::memcmp(header->hash, hash.constData(), sizeof(header->hash)) != 0) ||
+        (header->imageSize > static_cast<quint32>(std::numeric_limits<int>::max())) ||
+        (file->size() != static_cast<qint64>(sizeof(CacheHeader) + header->imageSize)))
+        return QSharedPointer<const ProfileImage>();
+
+    QByteArray data = QByteArray::fromRawData(reinterpret_cast<const char *>(mapped + sizeof(CacheHeader)),
+                                              static_cast<int>(header->imageSize));
+    QSharedPointer<const ProfileImage> image = ProfileImage::fromData(data, file);
+
+    if (image.isNull())
+        WARN() << "Ignoring damaged profile cache file: " << file->fileName();
+
+    return image;
+}
+
+/**
+ * @brief Writes the image of a successfully parsed profile to the cache
+ *  on a worker thread.
+ * @param[in] contents Contents of the profile file the image was parsed from.
+ */
+void ProfileCache::store(const QString &fileLocation, const QByteArray &contents, QSharedPointer<const ProfileImage> image)
+{
+    if (image.isNull() || contents.isEmpty())
+        return;
+
+    QtConcurrent::run([this, fileLocation, contents, image]() {
+        QByteArray data = serialize(fileLocation, contents, image);
+
+        if (!data.isEmpty())
+            write(cacheFilePath(fileLocation), data);
+    });
+}
+
+/**
+ * @brief Compares the time it takes to parse a profile with the time it
+ *  takes to load it from the cache and prints the result.
+ * @returns Exit code for the command line.
+ */
+int ProfileCache::benchmark(const QString &fileLocation, int iterations)
+{
+    QFile file(fileLocation);
+
+    if (!file.open(QFile::ReadOnly | QFile::Text))
+    {
+        PRINT_STDERR() << "Could not open profile " << fileLocation << "\n";
+        return 1;
+    }
+
+    QByteArray contents = file.readAll();
+    file.close();
+
+    QSharedPointer<const ProfileImage> image;
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0; i < iterations; i++)
+    {
+        QXmlStreamReader xml(contents);
+        xml.readNextStartElement();
+        image = ProfileImage::fromXml(&xml);
+
+        if (xml.hasError())
+        {
+            PRINT_STDERR() << "Could not parse profile " << fileLocation << ": " << xml.errorString() << "\n";
+            return 1;
+        }
+    }
+
+    qint64 parseTime = timer.nsecsElapsed() / iterations;
+
+    if (!write(cacheFilePath(fileLocation), serialize(fileLocation, contents, image)))
+        return 1;
+
+    timer.restart();
+
+    for (int i = 0; i < iterations; i++)
+    {
+        if (load(fileLocation, contents).isNull())
+        {
+            PRINT_STDERR() << "Could not load profile " << fileLocation << " from the cache\n";
+            return 1;
+        }
+    }
+
+    qint64 loadTime = timer.nsecsElapsed() / iterations;
+
+    PRINT_STDOUT() << "Profile " << fileLocation << ", average of " << iterations << " loads\n"
+                   << "XML:   " << contents.size() << " bytes, " << parseTime / 1000 << " us\n"
+                   << "Cache: " << image->data().size() << " bytes, " << loadTime / 1000 << " us\n";
+    return 0;
+}
+
+QString ProfileCache::cacheFilePath(const QString &fileLocation) const
+{
+    QString canonical = QFileInfo(fileLocation).canonicalFilePath();
+    QByteArray key = (canonical.isEmpty() ? fileLocation : canonical).toUtf8();
+    return m_directory + "/" + QString::fromLatin1(QCryptographicHash::hash(key, QCryptographicHash::Sha1).toHex()) +
+           ".bin";
+}
+
+QByteArray ProfileCache::serialize(const QString &fileLocation, const QByteArray &contents,
+                                   QSharedPointer<const ProfileImage> image) const
+{
+    QFileInfo info(fileLocation);
+    QByteArray hash = contentHash(contents);
+
+    if (!info.isFile() || (hash.size() != static_cast<int>(sizeof(CacheHeader::hash))))
+        return QByteArray();
+
+    CacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.modified = info.lastModified().toMSecsSinceEpoch();
+    header.size = info.size();
+    std::memcpy(header.hash, hash.constData(), sizeof(header.hash));
+    header.imageSize = static_cast<quint32>(image->data().size());
+
+    QByteArray data(reinterpret_cast<const char *>(&header), sizeof(header));
+    data.append(image->data());
+    return data;
+}
+
+/**
+ * @brief Replaces a cache file atomically, so readers never map a partially
+ *  written file.
+ */
+bool ProfileCache::write(const QString &cacheFile, const QByteArray &data) const
+{
+    if (data.isEmpty())
+        return false;
+
+    QDir().mkpath(m_directory);
+    QSaveFile file(cacheFile);
+    bool success = file.open(QSaveFile::WriteOnly) && (file.write(data) == data.size()) && file.commit();
+
+    if (!success)
+        WARN() << "Could not write profile cache file: " << cacheFile << " " << file.errorString();
+
+    return success;
+}
@@ -0,0 +1,54 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "profileimage.h"
+
+#include <QByteArray>
+#include <QSharedPointer>
+#include <QString>
+
+/**
+ * @brief Binary cache of parsed profiles.
+ *
+ * After a profile was parsed successfully, its ProfileImage is written to
+ * the cache directory. The next time the same profile is loaded, the image
+ * is memory mapped from the cache file instead of parsing the XML again.
+ * Cache files are named after the profile path and are only used if their
+ * format version, the modification time and size of the profile and the
+ * hash of its contents match.
+ */
+class ProfileCache
+{
+  public:
+    static ProfileCache *getInstance();
+
+    QSharedPointer<const ProfileImage> load(const QString &fileLocation, const QByteArray &contents);
+    void store(const QString &fileLocation, const QByteArray &contents, QSharedPointer<const ProfileImage> image);
+
+    int benchmark(const QString &fileLocation, int iterations);
+
+  private:
+    ProfileCache();
+
+    QString cacheFilePath(const QString &fileLocation) const;
+    QByteArray serialize(const QString &fileLocation, const QByteArray &contents,
+                         QSharedPointer<const ProfileImage> image) const;
+    bool write(const QString &cacheFile, const QByteArray &data) const;
+
+    QString m_directory;
+};
@@ -0,0 +1,290 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profileimage.h"
+
+#include <QFile>
+#include <QHash>
+#include <QXmlStreamReader>
+
+namespace {
+// Image layout: header, tokens, attributes, string offsets and the UTF-16
+// characters of all strings. Every part is aligned to its element size.
+struct ImageHeader
+{
+    quint32 tokenCount;
+    quint32 attributeCount;
+    quint32 stringCount;
+    quint32 charCount;
+};
+
+struct ImageToken
+{
+    quint16 type;
+    quint16 attributeCount;
+    quint32 string;
+    quint32 firstAttribute;
+};
+
+struct ImageAttribute
+{
+    quint32 name;
+    quint32 value;
+};
+
+const ImageHeader *imageHeader(const QByteArray &data) { return reinterpret_cast<const ImageHeader *>(data.constData()); }
+
+const ImageToken *imageTokens(const QByteArray &data)
+{
+    return reinterpret_cast<const ImageToken *>(data.constData() + sizeof(ImageHeader));
+}
+
+const ImageAttribute *imageAttributes(const QByteArray &data)
+{
+    return reinterpret_cast<const ImageAttribute *>(imageTokens(data) + imageHeader(data)->tokenCount);
+}
+
+const quint32 *imageOffsets(const QByteArray &data)
+{
+    return reinterpret_cast<const quint32 *>(imageAttributes(data) + imageHeader(data)->attributeCount);
+}
+
+const QChar *imageChars(const QByteArray &data)
+{
+    return reinterpret_cast<const QChar *>(imageOffsets(data) + imageHeader(data)->stringCount + 1);
+}
+
+class ImageBuilder
+{
+  public:
+    ImageBuilder() { m_offsets.append(0); }
+
+    void addToken(ProfileImage::TokenType type, const QString &string,
+                  const QXmlStreamAttributes &attributes = QXmlStreamAttributes())
+    {
+        ImageToken token;
+        token.type = static_cast<quint16>(type);
+        token.attributeCount = static_cast<quint16>(qMin(attributes.size(), 0xFFFF));
+        token.string = intern(string);
+        token.firstAttribute = static_cast<quint32>(m_attributes.size());
+
+        for (int i = 0; i < token.attributeCount; i++)
+            m_attributes.append({intern(attributes.at(i).qualifiedName().toString()),
+                                 intern(attributes.at(i).value().toString())});
+
+        m_tokens.append(token);
+    }
+
+    bool lastIsEndElement() const
+    {
+        return !m_tokens.isEmpty() && (m_tokens.last().type == ProfileImage::EndElement);
+    }
+
+    QByteArray build() const
+    {
+        ImageHeader header = {static_cast<quint32>(m_tokens.size()), static_cast<quint32>(m_attributes.size()),
+                              static_cast<quint32>(m_offsets.size() - 1), static_cast<quint32>(m_chars.size())};
+        QByteArray data;
+        append(data, &header, sizeof(header));
+        append(data, m_tokens.constData(), m_tokens.size() * sizeof(ImageToken));
+        append(data, m_attributes.constData(), m_attributes.size() * sizeof(ImageAttribute));
+        append(data, m_offsets.constData(), m_offsets.size() * sizeof(quint32));
+        append(data, m_chars.constData(), m_chars.size() * sizeof(QChar));
+        return data;
+    }
+
+  private:
+    static void append(QByteArray &data, const void *source, size_t size)
+    {
+        data.append(static_cast<const char *>(source), static_cast<int>(size));
+    }
+
+    quint32 intern(const QString &string)
+    {
+        auto iter = m_index.constFind(string);
+
+        if (iter != m_index.constEnd())
+            return iter.value();
+
+        quint32 index = static_cast<quint32>(m_offsets.size() - 1);
+        m_chars.append(string);
+        m_offsets.append(static_cast<quint32>(m_chars.size()));
+        m_index.insert(string, index);
+        return index;
+    }
+
+    QVector<ImageToken> m_tokens;
+    QVector<ImageAttribute> m_attributes;
+    QVector<quint32> m_offsets;
+    QString m_chars;
+    QHash<QString, quint32> m_index;
+};
+} // namespace
+
+ProfileImage::ProfileImage(const QByteArray &data, QSharedPointer<QFile> mapping)
+    : m_data(data)
+    , m_mapping(mapping)
+{
+}
+
+/**
+ * @brief Records the tokens of an XML stream, starting with the current one.
+ *
+ *  Whitespace between elements, comments and processing instructions are
+ *  dropped. The stream is read until its end or the first error, so the
+ *  caller has to check the stream for errors before using the image.
+ */
+QSharedPointer<const ProfileImage> ProfileImage::fromXml(QXmlStreamReader *xml)
+{
+    ImageBuilder builder;
+    QString whitespace;
+
+    while (true)
+    {
+        if (xml->isStartElement())
+        {
+            whitespace.clear();
+            builder.addToken(StartElement, xml->name().toString(), xml->attributes());
+        } else if (xml->isEndElement())
+        {
+            // Whitespace is only text if the element has no child elements.
+            if (!whitespace.isEmpty() && !builder.lastIsEndElement())
+                builder.addToken(Characters, whitespace);
+
+            whitespace.clear();
+            builder.addToken(EndElement, xml->name().toString());
+        } else if (xml->isWhitespace())
+        {
+            whitespace.append(xml->text());
+        } else if (xml->isCharacters() || xml->isEntityReference())
+        {
+            if (!whitespace.isEmpty())
+                builder.addToken(Characters, whitespace);
+
+            whitespace.clear();
+            builder.addToken(Characters, xml->text().toString());
+        }
+
+        if (xml->atEnd())
+            break;
+
+        xml->readNext();
+    }
+
+    QSharedPointer<ProfileImage> image(new ProfileImage(builder.build(), QSharedPointer<QFile>()));
+    image->initStrings();
+    return image;
+}
+
+/**
+ * @brief Uses previously built image data, e.g. from a mapped cache file.
+ * @param[in] mapping File which has to stay open while the data is used.
+ * @returns The image or a null pointer if the data is inconsistent.
+ */
+QSharedPointer<const ProfileImage> ProfileImage::fromData(const QByteArray &data, QSharedPointer<QFile> mapping)
+{
+    QSharedPointer<ProfileImage> image(new ProfileImage(data, mapping));
+
+    if (!image->validate())
+        return QSharedPointer<const ProfileImage>();
+
+    image->initStrings();
+    return image;
+}
+
+int ProfileImage::tokenCount() const { return static_cast<int>(imageHeader(m_data)->tokenCount); }
+
+ProfileImage::TokenType ProfileImage::tokenType(int index) const
+{
+    return static_cast<TokenType>(imageTokens(m_data)[index].type);
+}
+
+/**
+ * @brief Gets the element name of an element token or the text of a
+ *  characters token.
+ */
+const QString &ProfileImage::tokenString(int index) const { return m_strings.at(imageTokens(m_data)[index].string); }
+
+QXmlStreamAttributes ProfileImage::attributes(int index) const
+{
+    QXmlStreamAttributes result;
+    const ImageToken &token = imageTokens(m_data)[index];
+    const ImageAttribute *attributes = imageAttributes(m_data) + token.firstAttribute;
+
+    for (int i = 0; i < token.attributeCount; i++)
+        result.append(m_strings.at(attributes[i].name), m_strings.at(attributes[i].value));
+
+    return result;
+}
+
+/**
+ * @brief Checks that all sizes and indices of the data are in range.
+ */
+bool ProfileImage::validate() const
+{
+    if (m_data.size() < static_cast<int>(sizeof(ImageHeader)))
+        return false;
+
+    const ImageHeader *header = imageHeader(m_data);
+    quint64 expectedSize = sizeof(ImageHeader) + quint64(header->tokenCount) * sizeof(ImageToken) +
+                           quint64(header->attributeCount) * sizeof(ImageAttribute) +
+                           (quint64(header->stringCount) + 1) * sizeof(quint32) + quint64(header->charCount) * sizeof(QChar);
+
+    if (expectedSize != quint64(m_data.size()))
+        return false;
+
+    const quint32 *offsets = imageOffsets(m_data);
+
+    if ((offsets[0] != 0) || (offsets[header->stringCount] != header->charCount))
+        return false;
+
+    for (quint32 i = 0; i < header->stringCount; i++)
+    {
+        if (offsets[i] > offsets[i + 1])
+            return false;
+    }
+
+    const ImageToken *tokens = imageTokens(m_data);
+
+    for (quint32 i = 0; i < header->tokenCount; i++)
+    {
+        if ((tokens[i].type > Characters) || (tokens[i].string >= header->stringCount) ||
+            (quint64(tokens[i].firstAttribute) + tokens[i].attributeCount > header->attributeCount))
+            return false;
+    }
+
+    const ImageAttribute *attributes = imageAttributes(m_data);
+
+    for (quint32 i = 0; i < header->attributeCount; i++)
+    {
+        if ((attributes[i].name >= header->stringCount) || (attributes[i].value >= header->stringCount))
+            return false;
+    }
+
+    return true;
+}
+
+void ProfileImage::initStrings()
+{
+    quint32 stringCount = imageHeader(m_data)->stringCount;
+    const quint32 *offsets = imageOffsets(m_data);
+    const QChar *chars = imageChars(m_data);
+    m_strings.reserve(static_cast<int>(stringCount));
+
+    for (quint32 i = 0; i < stringCount; i++)
+        m_strings.append(QString::fromRawData(chars + offsets[i], static_cast<int>(offsets[i + 1] - offsets[i])));
+}
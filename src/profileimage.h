@@ -0,0 +1,69 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QByteArray>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+#include <QXmlStreamAttributes>
+
+class QFile;
+class QXmlStreamReader;
+
+/**
+ * @brief Parsed profile in a compact binary form.
+ *
+ * The image holds the element, end element and text tokens of a profile
+ * with all strings stored once in a shared table, so it can be read again
+ * with a ProfileReader without parsing XML. The data has no pointers and
+ * can be used directly from a memory mapped cache file.
+ */
+class ProfileImage
+{
+  public:
+    enum TokenType
+    {
+        StartElement,
+        EndElement,
+        Characters
+    };
+
+    static QSharedPointer<const ProfileImage> fromXml(QXmlStreamReader *xml);
+    static QSharedPointer<const ProfileImage> fromData(const QByteArray &data,
+                                                       QSharedPointer<QFile> mapping = QSharedPointer<QFile>());
+
+    const QByteArray &data() const { return m_data; }
+
+    int tokenCount() const;
+    TokenType tokenType(int index) const;
+    const QString &tokenString(int index) const;
+    QXmlStreamAttributes attributes(int index) const;
+
+  private:
+    ProfileImage(const QByteArray &data, QSharedPointer<QFile> mapping);
+    Q_DISABLE_COPY(ProfileImage)
+
+    bool validate() const;
+    void initStrings();
+
+    QByteArray m_data;
+    // Keeps a cache file mapped as long as its image is used.
+    QSharedPointer<QFile> m_mapping;
+    // Strings of the table, referencing m_data without a copy.
+    QVector<QString> m_strings;
+};
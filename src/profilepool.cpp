@@ -0,0 +1,243 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profilepool.h"
+
+#include "globalvariables.h"
+#include "logger.h"
+#include "profilecache.h"
+#include "xmlconfigmigration.h"
+
+#include <QBuffer>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QXmlStreamReader>
+#include <QtConcurrent>
+
+namespace {
+QString poolKey(const QString &fileLocation)
+{
+    QString canonical = QFileInfo(fileLocation).canonicalFilePath();
+    return canonical.isEmpty() ? fileLocation : canonical;
+}
+} // namespace
+
+/**
+ * @brief Takes the stamp of a file. The stamp is invalid if the file does
+ *  not exist.
+ */
+ProfilePool::Stamp ProfilePool::Stamp::of(const QString &fileLocation)
+{
+    QFileInfo info(fileLocation);
+
+    if (!info.isFile())
+        return {QDateTime(), -1};
+
+    return {info.lastModified(), info.size()};
+}
+
+bool ProfilePool::Stamp::isValid() const { return modified.isValid(); }
+
+bool ProfilePool::Stamp::operator==(const Stamp &other) const
+{
+    return (modified == other.modified) && (size == other.size);
+}
+
+bool ProfilePool::Stamp::operator!=(const Stamp &other) const { return !(*this == other); }
+
+ProfilePool::ProfilePool() {}
+
+ProfilePool *ProfilePool::getInstance()
+{
+    static ProfilePool pool;
+    return &pool;
+}
+
+/**
+ * @brief Reads and parses a profile in the background unless it is already
+ *  pooled.
+ */
+void ProfilePool::preload(const QString &fileLocation)
+{
+    if (fileLocation.isEmpty())
+        return;
+
+    QString key = poolKey(fileLocation);
+    Stamp stamp = Stamp::of(key);
+
+    if (!stamp.isValid())
+        return;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        auto iter = m_entries.constFind(key);
+
+        if ((iter != m_entries.constEnd()) && (iter->stamp == stamp))
+            return;
+
+        if (m_pending.contains(key))
+            return;
+
+        m_pending.insert(key);
+    }
+
+    QtConcurrent::run([this, key]() { readProfile(key); });
+}
+
+void ProfilePool::preload(const QStringList &fileLocations)
+{
+    for (const QString &fileLocation : fileLocations)
+        preload(fileLocation);
+}
+
+/**
+ * @brief Gets the pooled image of a profile.
+ * @returns The image or a null pointer if the profile is not pooled or the
+ *  file changed since it was parsed.
+ */
+QSharedPointer<const ProfileImage> ProfilePool::lookup(const QString &fileLocation)
+{
+    QString key = poolKey(fileLocation);
+    Stamp stamp = Stamp::of(key);
+    QMutexLocker locker(&m_mutex);
+    auto iter = m_entries.find(key);
+
+    if (iter == m_entries.end())
+        return QSharedPointer<const ProfileImage>();
+
+    if (!stamp.isValid() || (iter->stamp != stamp))
+    {
+        m_entries.erase(iter);
+        m_order.removeOne(key);
+        return QSharedPointer<const ProfileImage>();
+    }
+
+    m_order.removeOne(key);
+    m_order.append(key);
+    return iter->image;
+}
+
+/**
+ * @brief Adds the image of a profile which was just parsed without errors.
+ * @param stamp Stamp of the file taken before its contents were read. The
+ *  image is dropped if the file changed since then.
+ */
+void ProfilePool::store(const QString &fileLocation, const Stamp &stamp, QSharedPointer<const ProfileImage> image)
+{
+    QString key = poolKey(fileLocation);
+
+    if (!stamp.isValid() || image.isNull() || (Stamp::of(key) != stamp))
+        return;
+
+    QMutexLocker locker(&m_mutex);
+    insert(key, {image, stamp});
+}
+
+/**
+ * @brief Drops a profile from the pool, e.g. because it is written.
+ */
+void ProfilePool::invalidate(const QString &fileLocation)
+{
+    QString key = poolKey(fileLocation);
+    QMutexLocker locker(&m_mutex);
+    m_entries.remove(key);
+    m_order.removeOne(key);
+}
+
+void ProfilePool::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+    m_order.clear();
+}
+
+/**
+ * @brief Loads the image of a profile from the cache or parses it.
+ *
+ *  Profiles which need a migration are not pooled, as the migration has to
+ *  rewrite the file when the profile is loaded.
+ */
+void ProfilePool::readProfile(QString fileLocation)
+{
+    Stamp stamp = Stamp::of(fileLocation);
+    QFile file(fileLocation);
+    QByteArray contents;
+    QSharedPointer<const ProfileImage> image;
+
+    if (file.open(QFile::ReadOnly | QFile::Text))
+        contents = file.readAll();
+    else
+        WARN() << "Could not preload profile: " << fileLocation;
+
+    if (!contents.isEmpty())
+        image = ProfileCache::getInstance()->load(fileLocation, contents);
+
+    if (image.isNull() && !contents.isEmpty())
+    {
+        QBuffer buffer(&contents);
+        buffer.open(QBuffer::ReadOnly | QBuffer::Text);
+        QXmlStreamReader xml(&buffer);
+        xml.readNextStartElement();
+
+        bool deviceProfile = (xml.name() == GlobalVariables::Joystick::xmlName) ||
+                             (xml.name() == GlobalVariables::GameController::xmlName);
+
+        if (deviceProfile && !XMLConfigMigration(&xml).requiresMigration())
+        {
+            image = ProfileImage::fromXml(&xml);
+
+            if (xml.hasError())
+            {
+                WARN() << "Could not preload profile: " << fileLocation << " " << xml.errorString();
+                image.clear();
+            } else
+            {
+                ProfileCache::getInstance()->store(fileLocation, contents, image);
+            }
+        }
+    }
+
+    QMutexLocker locker(&m_mutex);
+    m_pending.remove(fileLocation);
+
+    if (image.isNull())
+        return;
+
+    if (Stamp::of(fileLocation) != stamp)
+    {
+        DEBUG() << "Profile changed while it was preloaded: " << fileLocation;
+        return;
+    }
+
+    insert(fileLocation, {image, stamp});
+    DEBUG() << "Preloaded profile: " << fileLocation;
+}
+
+/**
+ * @brief Inserts or replaces an entry and evicts the least recently
+ *  used ones if the pool is full. The mutex must be held.
+ */
+void ProfilePool::insert(const QString &key, const Entry &entry)
+{
+    m_entries.insert(key, entry);
+    m_order.removeOne(key);
+    m_order.append(key);
+
+    while (m_order.size() > GlobalVariables::ProfilePool::CAPACITY)
+        m_entries.remove(m_order.takeFirst());
+}
@@ -0,0 +1,85 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "profileimage.h"
+
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief Bounded LRU pool of parsed profiles.
+ *
+ * Profiles referenced by auto profile rules and load profile slots are read
+ * and parsed, or loaded from the ProfileCache, in the background. Switching
+ * to them does not have to wait for storage or the XML parser and only
+ * applies the pooled ProfileImage to the device.
+ * Entries are validated against the modification time and size of the file
+ * on every lookup. The pool is shared by all threads.
+ */
+class ProfilePool
+{
+  public:
+    /**
+     * @brief Modification time and size of a profile file. It is taken
+     *  before the file is read, so contents which changed while they were
+     *  read do not match the file any more and are not pooled.
+     */
+    struct Stamp
+    {
+        QDateTime modified;
+        qint64 size;
+
+        static Stamp of(const QString &fileLocation);
+        bool isValid() const;
+        bool operator==(const Stamp &other) const;
+        bool operator!=(const Stamp &other) const;
+    };
+
+    static ProfilePool *getInstance();
+
+    void preload(const QString &fileLocation);
+    void preload(const QStringList &fileLocations);
+    QSharedPointer<const ProfileImage> lookup(const QString &fileLocation);
+    void store(const QString &fileLocation, const Stamp &stamp, QSharedPointer<const ProfileImage> image);
+    void invalidate(const QString &fileLocation);
+    void clear();
+
+  private:
+    ProfilePool();
+
+    struct Entry
+    {
+        QSharedPointer<const ProfileImage> image;
+        Stamp stamp;
+    };
+
+    void readProfile(QString fileLocation);
+    void insert(const QString &key, const Entry &entry);
+
+    QMutex m_mutex;
+    QHash<QString, Entry> m_entries;
+    // Least recently used entry first.
+    QStringList m_order;
+    // Locations currently read in the background.
+    QSet<QString> m_pending;
+};
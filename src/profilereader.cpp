@@ -0,0 +1,144 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profilereader.h"
+
+#include <QCoreApplication>
+
+ProfileReader::ProfileReader(QSharedPointer<const ProfileImage> image)
+    : m_image(image)
+    , m_position(-1)
+    , m_error(false)
+{
+}
+
+/**
+ * @brief Checks if all tokens are read or reading stopped with an error.
+ */
+bool ProfileReader::atEnd() const { return m_error || (m_position >= m_image->tokenCount()); }
+
+void ProfileReader::readNext()
+{
+    if (atEnd())
+        return;
+
+    m_position++;
+
+    if (isStartElement() || isEndElement())
+        m_name = m_image->tokenString(m_position);
+    else
+        m_name.clear();
+}
+
+/**
+ * @brief Reads until the next start element within the current element.
+ * @returns False if the end of the current element or document is reached.
+ */
+bool ProfileReader::readNextStartElement()
+{
+    while (!atEnd())
+    {
+        readNext();
+
+        if (isEndElement())
+            return false;
+        else if (isStartElement())
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Reads until the end of the current element, skipping all children.
+ */
+void ProfileReader::skipCurrentElement()
+{
+    int depth = 1;
+
+    while ((depth > 0) && !atEnd())
+    {
+        readNext();
+
+        if (isEndElement())
+            depth--;
+        else if (isStartElement())
+            depth++;
+    }
+}
+
+/**
+ * @brief Reads the text of the current element and stops at its end.
+ *  Raises an error if the element contains child elements.
+ */
+QString ProfileReader::readElementText()
+{
+    if (!isStartElement())
+        return QString();
+
+    QString result;
+
+    while (!atEnd())
+    {
+        readNext();
+
+        if (isEndElement())
+            return result;
+
+        if (isStartElement())
+        {
+            raiseError(QCoreApplication::translate("ProfileReader", "Expected character data."));
+            return result;
+        }
+
+        if (!atEnd())
+            result.append(m_image->tokenString(m_position));
+    }
+
+    raiseError(QCoreApplication::translate("ProfileReader", "Premature end of document."));
+    return result;
+}
+
+bool ProfileReader::isStartElement() const
+{
+    return !atEnd() && (m_position >= 0) && (m_image->tokenType(m_position) == ProfileImage::StartElement);
+}
+
+bool ProfileReader::isEndElement() const
+{
+    return !atEnd() && (m_position >= 0) && (m_image->tokenType(m_position) == ProfileImage::EndElement);
+}
+
+QStringRef ProfileReader::name() const { return QStringRef(&m_name); }
+
+QXmlStreamAttributes ProfileReader::attributes() const
+{
+    if (!isStartElement())
+        return QXmlStreamAttributes();
+
+    return m_image->attributes(m_position);
+}
+
+void ProfileReader::raiseError(const QString &message)
+{
+    m_error = true;
+    m_errorString = message;
+}
+
+bool ProfileReader::hasError() const { return m_error; }
+
+QString ProfileReader::errorString() const { return m_errorString; }
@@ -0,0 +1,63 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "profileimage.h"
+
+#include <QMetaType>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringRef>
+#include <QXmlStreamAttributes>
+
+/**
+ * @brief Reads the tokens of a ProfileImage.
+ *
+ * Provides the subset of the QXmlStreamReader interface used by the profile
+ * readers with the same semantics, so profiles can be read either from
+ * freshly parsed XML or from the binary profile cache.
+ */
+class ProfileReader
+{
+  public:
+    explicit ProfileReader(QSharedPointer<const ProfileImage> image);
+
+    bool atEnd() const;
+    void readNext();
+    bool readNextStartElement();
+    void skipCurrentElement();
+    QString readElementText();
+
+    bool isStartElement() const;
+    bool isEndElement() const;
+    QStringRef name() const;
+    QXmlStreamAttributes attributes() const;
+
+    void raiseError(const QString &message = QString());
+    bool hasError() const;
+    QString errorString() const;
+
+  private:
+    QSharedPointer<const ProfileImage> m_image;
+    // Index of the current token, -1 before the first one.
+    int m_position;
+    QString m_name;
+    bool m_error;
+    QString m_errorString;
+};
+
+Q_DECLARE_METATYPE(ProfileReader *)
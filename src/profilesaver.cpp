@@ -0,0 +1,108 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profilesaver.h"
+
+#include "logger.h"
+#include "profilepool.h"
+
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QtConcurrent>
+
+ProfileSaver::ProfileSaver(QObject *parent)
+    : QObject(parent)
+{
+}
+
+ProfileSaver *ProfileSaver::getInstance()
+{
+    static ProfileSaver saver;
+    return &saver;
+}
+
+/**
+ * @brief Queues contents to be written to a profile file.
+ */
+void ProfileSaver::save(const QString &fileLocation, const QByteArray &contents)
+{
+    ProfilePool::getInstance()->invalidate(fileLocation);
+
+    QMutexLocker locker(&m_mutex);
+    m_queued.insert(fileLocation, contents);
+
+    if (m_running.contains(fileLocation))
+        return;
+
+    m_running.insert(fileLocation);
+    QtConcurrent::run([this, fileLocation]() { writeQueued(fileLocation); });
+}
+
+/**
+ * @brief Blocks until all queued saves of the given file are written.
+ */
+void ProfileSaver::waitForPending(const QString &fileLocation)
+{
+    QMutexLocker locker(&m_mutex);
+
+    while (m_running.contains(fileLocation))
+        m_finished.wait(&m_mutex);
+}
+
+/**
+ * @brief Blocks until all queued saves are written.
+ */
+void ProfileSaver::waitForAll()
+{
+    QMutexLocker locker(&m_mutex);
+
+    while (!m_running.isEmpty())
+        m_finished.wait(&m_mutex);
+}
+
+void ProfileSaver::writeQueued(QString fileLocation)
+{
+    QMutexLocker locker(&m_mutex);
+
+    while (m_queued.contains(fileLocation))
+    {
+        QByteArray contents = m_queued.take(fileLocation);
+        locker.unlock();
+
+        QSaveFile file(fileLocation);
+        bool success = file.open(QSaveFile::WriteOnly) && (file.write(contents) == contents.size()) && file.commit();
+        QString errorString = success ? QString() : tr("Could not write to profile at %1.").arg(fileLocation);
+
+        if (success)
+            ProfilePool::getInstance()->preload(fileLocation);
+        else
+            WARN() << errorString << " " << file.errorString();
+
+        locker.relock();
+
+        // Only report the result of the latest contents.
+        if (!m_queued.contains(fileLocation))
+        {
+            locker.unlock();
+            emit saveFinished(fileLocation, success, errorString);
+            locker.relock();
+        }
+    }
+
+    m_running.remove(fileLocation);
+    m_finished.wakeAll();
+}
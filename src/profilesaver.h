@@ -0,0 +1,63 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QWaitCondition>
+
+/**
+ * @brief Writes serialized profiles to disk on a worker thread.
+ *
+ * Files are replaced atomically through a temporary file. Saving a profile
+ * again while a previous save of the same file is still queued replaces the
+ * queued contents, so a burst of saves results in a single write.
+ */
+class ProfileSaver : public QObject
+{
+    Q_OBJECT
+
+  public:
+    static ProfileSaver *getInstance();
+
+    void save(const QString &fileLocation, const QByteArray &contents);
+    void waitForPending(const QString &fileLocation);
+    void waitForAll();
+
+  signals:
+    /**
+     * @brief Emitted from the worker thread when a queued save finished.
+     * @param[in] errorString Reason of the failure, empty on success.
+     */
+    void saveFinished(QString fileLocation, bool success, QString errorString);
+
+  private:
+    explicit ProfileSaver(QObject *parent = nullptr);
+
+    void writeQueued(QString fileLocation);
+
+    QMutex m_mutex;
+    QWaitCondition m_finished;
+    // Latest contents not yet picked up by a worker.
+    QHash<QString, QByteArray> m_queued;
+    // Locations which have a worker running.
+    QSet<QString> m_running;
+};
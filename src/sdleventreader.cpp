@@ -40,6 +40,8 @@ SDLEventReader::SDLEventReader(QMap<SDL_JoystickID, InputDevice *> *joysticks, A
     settings->getLock()->lock();
     this->pollRate =
         settings->value("GamepadPollRate", GlobalVariables::AntimicroSettings::defaultSDLGamepadPollRate).toUInt();
+    this->eventDriven =
+        settings->value("GamepadEventDriven", GlobalVariables::AntimicroSettings::defaultSDLEventDrivenReader).toBool();
     settings->getLock()->unlock();
 
     pollRateTimer.setParent(this);
@@ -96,7 +98,7 @@ void SDLEventReader::initSDL()
     settings->getLock()->unlock();
 
     pollRateTimer.stop();
-    pollRateTimer.setInterval(pollRate);
+    pollRateTimer.setInterval(eventDriven ? 0 : pollRate);
 
     emit sdlStarted();
 }
@@ -172,7 +174,26 @@ void SDLEventReader::clearEvents()
 
 bool SDLEventReader::isSDLOpen() { return sdlIsOpen; }
 
+/**
+ * @brief Checks whether SDL has pending events. When no event is found,
+ *   pollRateTimer is armed so performWork is invoked again later.
+ * @return 1 when at least one event is waiting in the SDL queue, 0 otherwise
+ */
 int SDLEventReader::eventStatus()
+{
+    int result = eventDriven ? waitEventStatus() : pollEventStatus();
+
+    if ((result == 0) && !pollRateTimer.isActive())
+        pollRateTimer.start();
+
+    return result;
+}
+
+/**
+ * @brief Non-blocking check of the SDL queue. Latency of a new event
+ *   is bounded by the gamepad poll rate.
+ */
+int SDLEventReader::pollEventStatus()
 {
     int result = 0;
 
@@ -187,9 +208,6 @@ int SDLEventReader::eventStatus()
         break;
     }
     case 0: {
-        if (!pollRateTimer.isActive())
-            pollRateTimer.start();
-
         break;
     }
     default: {
@@ -201,6 +219,18 @@ int SDLEventReader::eventStatus()
     return result;
 }
 
+/**
+ * @brief Blocks the worker thread until SDL reports an event or
+ *   EVENTWAITTIMEOUT elapses. The event is left in the SDL queue so that
+ *   InputDaemon can fetch it. On timeout, pollRateTimer (interval 0 in this
+ *   mode) gives the worker thread event loop a chance to process queued
+ *   slots like stop() or refresh() before waiting again.
+ */
+int SDLEventReader::waitEventStatus()
+{
+    return (SDL_WaitEventTimeout(nullptr, GlobalVariables::SDLEventReader::EVENTWAITTIMEOUT) > 0) ? 1 : 0;
+}
+
 void SDLEventReader::updatePollRate(int tempPollRate)
 {
     if ((tempPollRate >= 1) && (tempPollRate <= 16))
@@ -209,7 +239,28 @@ void SDLEventReader::updatePollRate(int tempPollRate)
         pollRateTimer.stop();
 
         this->pollRate = tempPollRate;
-        pollRateTimer.setInterval(pollRate);
+
+        if (!eventDriven)
+            pollRateTimer.setInterval(pollRate);
+
+        if (pollTimerWasActive)
+            pollRateTimer.start();
+    }
+}
+
+/**
+ * @brief Switch between polling SDL every pollRate ms and blocking on the
+ *   SDL queue until an event arrives.
+ */
+void SDLEventReader::setEventDriven(bool eventDriven)
+{
+    if (this->eventDriven != eventDriven)
+    {
+        bool pollTimerWasActive = pollRateTimer.isActive();
+        pollRateTimer.stop();
+
+        this->eventDriven = eventDriven;
+        pollRateTimer.setInterval(eventDriven ? 0 : pollRate);
 
         if (pollTimerWasActive)
             pollRateTimer.start();
@@ -56,6 +56,7 @@ class SDLEventReader : public QObject
     void stop();
     void refresh();
     void updatePollRate(int tempPollRate); // (unsigned)
+    void setEventDriven(bool eventDriven);
     void resetJoystickMap();
     void quit();
     void closeDevices();
@@ -69,9 +70,12 @@ class SDLEventReader : public QObject
     bool sdlIsOpen;
     AntiMicroSettings *settings;
     int pollRate;
+    bool eventDriven;
     QTimer pollRateTimer;
 
     void loadSdlMappingsFromDatabase();
+    int pollEventStatus();
+    int waitEventStatus();
 };
 
 #endif // SDLEVENTREADER_H
@@ -54,21 +54,74 @@ SetJoystick::SetJoystick(InputDevice *device, int index, bool runreset, QObject
 
 SetJoystick::~SetJoystick() { removeAllBtnFromQueue(); }
 
-JoyButton *SetJoystick::getJoyButton(int index) const { return getButtons().value(index); }
+namespace {
+template <typename T> inline T *lookupElement(const QVector<T *> &table, int index)
+{
+    return ((index >= 0) && (index < table.size())) ? table.at(index) : nullptr;
+}
+
+template <typename Key, typename T> void fillElementTable(QVector<T *> &table, const QHash<Key, T *> &elements)
+{
+    int size = 0;
+    for (auto iter = elements.cbegin(); iter != elements.cend(); ++iter)
+        size = qMax(size, static_cast<int>(iter.key()) + 1);
+
+    table.fill(nullptr, size);
+
+    for (auto iter = elements.cbegin(); iter != elements.cend(); ++iter)
+    {
+        if (static_cast<int>(iter.key()) >= 0)
+            table[static_cast<int>(iter.key())] = iter.value();
+    }
+}
+} // namespace
+
+JoyButton *SetJoystick::getJoyButton(int index) const
+{
+    return lookupElement(m_button_table, index);
+}
 
 JoyAxis *SetJoystick::getJoyAxis(int index) const
 {
     Q_ASSERT(!axes.isEmpty());
-    return axes.value(index);
+
+    return lookupElement(m_axis_table, index);
 }
 
-JoyDPad *SetJoystick::getJoyDPad(int index) const { return getHats().value(index); }
+JoyDPad *SetJoystick::getJoyDPad(int index) const
+{
+    return lookupElement(m_hat_table, index);
+}
 
-VDPad *SetJoystick::getVDPad(int index) const { return getVdpads().value(index); }
+VDPad *SetJoystick::getVDPad(int index) const
+{
+    return lookupElement(m_vdpad_table, index);
+}
 
-JoyControlStick *SetJoystick::getJoyStick(int index) const { return getSticks().value(index); }
+JoyControlStick *SetJoystick::getJoyStick(int index) const
+{
+    return lookupElement(m_stick_table, index);
+}
 
-JoySensor *SetJoystick::getSensor(JoySensorType type) const { return m_sensors.value(type); }
+JoySensor *SetJoystick::getSensor(JoySensorType type) const
+{
+    return lookupElement(m_sensor_table, static_cast<int>(type));
+}
+
+/**
+ * @brief Rebuild the dense element tables from the element hashes. Has to
+ *  be called whenever one of the element hashes is modified, so lookups on
+ *  the input thread never modify the set.
+ */
+void SetJoystick::rebuildElementTables()
+{
+    fillElementTable(m_button_table, m_buttons);
+    fillElementTable(m_axis_table, axes);
+    fillElementTable(m_hat_table, hats);
+    fillElementTable(m_stick_table, sticks);
+    fillElementTable(m_sensor_table, m_sensors);
+    fillElementTable(m_vdpad_table, vdpads);
+}
 
 void SetJoystick::refreshButtons()
 {
@@ -80,6 +133,8 @@ void SetJoystick::refreshButtons()
         m_buttons.insert(i, button);
         enableButtonConnections(button);
     }
+
+    rebuildElementTables();
 }
 
 void SetJoystick::refreshAxes()
@@ -100,6 +155,8 @@ void SetJoystick::refreshAxes()
 
         enableAxisConnections(axis);
     }
+
+    rebuildElementTables();
 }
 
 void SetJoystick::refreshHats()
@@ -112,6 +169,8 @@ void SetJoystick::refreshHats()
         hats.insert(i, dpad);
         enableHatConnections(dpad);
     }
+
+    rebuildElementTables();
 }
 
 /**
@@ -132,6 +191,8 @@ void SetJoystick::refreshSensors()
         m_sensors.insert(type, sensor);
         enableSensorConnections(sensor);
     }
+
+    rebuildElementTables();
 }
 
 void SetJoystick::deleteButtons()
@@ -150,6 +211,7 @@ void SetJoystick::deleteButtons()
     }
 
     m_buttons.clear();
+    rebuildElementTables();
 }
 
 void SetJoystick::deleteAxes()
@@ -168,6 +230,7 @@ void SetJoystick::deleteAxes()
     }
 
     axes.clear();
+    rebuildElementTables();
 }
 
 void SetJoystick::deleteSticks()
@@ -186,6 +249,7 @@ void SetJoystick::deleteSticks()
     }
 
     sticks.clear();
+    rebuildElementTables();
 }
 
 void SetJoystick::deleteVDpads()
@@ -204,6 +268,7 @@ void SetJoystick::deleteVDpads()
     }
 
     vdpads.clear();
+    rebuildElementTables();
 }
 
 void SetJoystick::deleteHats()
@@ -222,6 +287,7 @@ void SetJoystick::deleteHats()
     }
 
     hats.clear();
+    rebuildElementTables();
 }
 
 /**
@@ -236,6 +302,7 @@ void SetJoystick::deleteSensors()
     }
 
     m_sensors.clear();
+    rebuildElementTables();
 }
 
 int SetJoystick::getNumberButtons() const { return getButtons().count(); }
@@ -436,6 +503,7 @@ void SetJoystick::propogateSetAxisThrottleSetting(int index)
 void SetJoystick::addControlStick(int index, JoyControlStick *stick)
 {
     sticks.insert(index, stick);
+    rebuildElementTables();
     connect(stick, &JoyControlStick::stickNameChanged, this, &SetJoystick::propogateSetStickNameChange);
 
     QHashIterator<JoyStickDirectionsType::JoyStickDirections, JoyControlStickButton *> iter(*stick->getButtons());
@@ -465,6 +533,7 @@ void SetJoystick::removeControlStick(int index)
     {
         JoyControlStick *stick = getSticks().value(index);
         sticks.remove(index);
+        rebuildElementTables();
         stick->deleteLater();
         stick = nullptr;
     }
@@ -473,6 +542,7 @@ void SetJoystick::removeControlStick(int index)
 void SetJoystick::addVDPad(int index, VDPad *vdpad)
 {
     vdpads.insert(index, vdpad);
+    rebuildElementTables();
     connect(vdpad, &VDPad::dpadNameChanged, this, &SetJoystick::propogateSetVDPadNameChange);
 
     QHashIterator<int, JoyDPadButton *> iter(*vdpad->getButtons());
@@ -499,6 +569,7 @@ void SetJoystick::removeVDPad(int index)
     {
         VDPad *vdpad = vdpads.value(index);
         vdpads.remove(index);
+        rebuildElementTables();
         vdpad->deleteLater();
         vdpad = nullptr;
     }
@@ -1098,7 +1169,16 @@ void SetJoystick::setAxisThrottle(int axisNum, JoyAxis::ThrottleTypes throttle)
     }
 }
 
-QHash<int, JoyAxis *> *SetJoystick::getAxes() { return &axes; }
+QHash<int, JoyAxis *> const &SetJoystick::getAxes() const { return axes; }
+
+/**
+ * @brief Adds an axis created by a subclass, e.g. a game controller trigger.
+ */
+void SetJoystick::insertAxis(int index, JoyAxis *axis)
+{
+    axes.insert(index, axis);
+    rebuildElementTables();
+}
 
 QHash<int, JoyButton *> const &SetJoystick::getButtons() const { return m_buttons; }
 
@@ -24,6 +24,8 @@
 #include "joysensortype.h"
 #include "xml/setjoystickxml.h"
 
+#include <QVector>
+
 class InputDevice;
 class JoyButton;
 class JoyDPad;
@@ -64,7 +66,7 @@ class SetJoystick : public SetJoystickXml
     QHash<int, JoyControlStick *> const &getSticks() const;
     QHash<JoySensorType, JoySensor *> const &getSensors() const;
     QHash<int, VDPad *> const &getVdpads() const;
-    QHash<int, JoyAxis *> *getAxes();
+    QHash<int, JoyAxis *> const &getAxes() const;
 
     int getIndex() const;
     int getRealIndex() const;
@@ -102,6 +104,8 @@ class SetJoystick : public SetJoystickXml
     void deleteSensors();
     void deleteVDpads(); // SetVDPad class
 
+    void insertAxis(int index, JoyAxis *axis); // SetAxis class
+
     void enableButtonConnections(JoyButton *button); // SetButton class
     void enableAxisConnections(JoyAxis *axis);       // SetAxis class
     void enableHatConnections(JoyDPad *dpad);        // SetHat class
@@ -187,6 +191,8 @@ class SetJoystick : public SetJoystickXml
     void propogateSetVDPadNameChange(); // SetVDPad class
 
   private:
+    void rebuildElementTables();
+
     QHash<int, JoyButton *> m_buttons;
     QHash<int, JoyAxis *> axes;
     QHash<int, JoyDPad *> hats;
@@ -194,6 +200,15 @@ class SetJoystick : public SetJoystickXml
     QHash<JoySensorType, JoySensor *> m_sensors;
     QHash<int, VDPad *> vdpads;
 
+    // Dense index-addressed copies of the element hashes used for lookups
+    // on the input hot path. Rebuilt whenever the hashes change.
+    QVector<JoyButton *> m_button_table;
+    QVector<JoyAxis *> m_axis_table;
+    QVector<JoyDPad *> m_hat_table;
+    QVector<JoyControlStick *> m_stick_table;
+    QVector<JoySensor *> m_sensor_table;
+    QVector<VDPad *> m_vdpad_table;
+
     QList<JoyButton *> lastClickedButtons;
 
     int m_index;
@@ -24,7 +24,15 @@
 #include <X11/Xatom.h>
 #include <unistd.h>
 
+#ifdef WITH_XCB
+    #include <X11/Xlib-xcb.h>
+    #include <xcb/xcb.h>
+
+    #include <cstdlib>
+#endif
+
 #include <QDebug>
+#include <QFile>
 #include <QFileInfo>
 #include <QThreadStorage>
 
@@ -37,6 +45,9 @@ X11Extras *X11Extras::_instance = nullptr;
 X11Extras::X11Extras(QObject *parent)
     : QObject(parent)
     , knownAliases()
+    , lastInfoWindow(0)
+    , windowInfoCacheHits(0)
+    , windowInfoCacheMisses(0)
 {
     _display = XOpenDisplay(nullptr);
     populateKnownAliases();
@@ -167,8 +178,256 @@ void X11Extras::populateKnownAliases()
     }
 }
 
+#ifdef WITH_XCB
+
+namespace {
+
+/**
+ * @brief Pending requests to check whether a window is viewable and relevant.
+ */
+struct WindowCheck
+{
+    xcb_get_window_attributes_cookie_t attributes;
+    xcb_get_property_cookie_t properties[3];
+};
+
+struct WindowCheckResult
+{
+    bool viewable;
+    bool relevant;
+};
+
+/**
+ * @brief Sends the requests of X11Extras::windowIsViewable() and
+ *     X11Extras::isWindowRelevant() without waiting for replies.
+ */
+WindowCheck requestWindowCheck(xcb_connection_t *connection, xcb_window_t window, const xcb_atom_t *atoms)
+{
+    WindowCheck check;
+    check.attributes = xcb_get_window_attributes(connection, window);
+
+    // Atoms which do not exist yet cannot be set on any window.
+    for (int i = 0; i < 3; i++)
+    {
+        check.properties[i].sequence = 0;
+
+        if (atoms[i] != XCB_NONE)
+        {
+            check.properties[i] =
+                xcb_get_property(connection, false, window, atoms[i], XCB_GET_PROPERTY_TYPE_ANY, 0, 1024);
+        }
+    }
+
+    return check;
+}
+
+/**
+ * @brief Collects all replies of a window check. Errors, e.g. for destroyed
+ *     windows, are consumed here so they never reach the Xlib error handler.
+ *     Such windows are reported as neither viewable nor relevant.
+ */
+WindowCheckResult collectWindowCheck(xcb_connection_t *connection, const WindowCheck &check)
+{
+    WindowCheckResult result = {false, false};
+    xcb_generic_error_t *error = nullptr;
+
+    xcb_get_window_attributes_reply_t *attributes =
+        xcb_get_window_attributes_reply(connection, check.attributes, &error);
+    if (attributes != nullptr)
+    {
+        result.viewable =
+            (attributes->_class == XCB_WINDOW_CLASS_INPUT_OUTPUT) && (attributes->map_state == XCB_MAP_STATE_VIEWABLE);
+        free(attributes);
+    }
+
+    free(error);
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (check.properties[i].sequence == 0)
+            continue;
+
+        error = nullptr;
+        xcb_get_property_reply_t *property = xcb_get_property_reply(connection, check.properties[i], &error);
+        if (property != nullptr)
+        {
+            result.relevant = result.relevant || (property->type != XCB_NONE);
+            free(property);
+        }
+
+        free(error);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Gets the atoms checked by X11Extras::isWindowRelevant().
+ */
+void getRelevantAtoms(Display *display, xcb_atom_t *atoms)
+{
+    atoms[0] = XInternAtom(display, "WM_STATE", True);
+    atoms[1] = XInternAtom(display, "_NW_WM_STATE", True);
+    atoms[2] = XInternAtom(display, "_NW_WM_NAME", True);
+}
+
+/**
+ * @brief XCB implementation of findParentClient(). The window check and the
+ *     tree query of each level are sent together, so every level of the
+ *     hierarchy costs a single round trip instead of up to five.
+ */
+Window findParentClientBatched(Display *display, Window window)
+{
+    xcb_connection_t *connection = XGetXCBConnection(display);
+    xcb_atom_t atoms[3];
+    getRelevantAtoms(display, atoms);
+
+    Window finalwindow = 0;
+    xcb_window_t current = static_cast<xcb_window_t>(window);
+    bool isRoot = false;
+
+    while (current != XCB_NONE)
+    {
+        WindowCheck check = requestWindowCheck(connection, current, atoms);
+        xcb_query_tree_cookie_t treeCookie = xcb_query_tree(connection, current);
+        WindowCheckResult result = collectWindowCheck(connection, check);
+
+        if ((result.viewable && result.relevant) || isRoot)
+        {
+            xcb_discard_reply(connection, treeCookie.sequence);
+
+            if (result.viewable && result.relevant)
+                finalwindow = current;
+
+            break;
+        }
+
+        // The tree reply arrived together with the check replies.
+        xcb_generic_error_t *error = nullptr;
+        xcb_query_tree_reply_t *tree = xcb_query_tree_reply(connection, treeCookie, &error);
+        free(error);
+
+        if (tree == nullptr)
+            break;
+
+        isRoot = (tree->parent == tree->root);
+        current = tree->parent;
+        free(tree);
+    }
+
+    return finalwindow;
+}
+
+struct WindowTreeNode
+{
+    xcb_window_t window;
+    WindowCheckResult check;
+    QVector<int> children;
+};
+
+/**
+ * @brief Searches a fetched window tree in the same order as the Xlib
+ *     implementation of X11Extras::findClientWindow().
+ */
+Window searchClientWindow(const QVector<WindowTreeNode> &nodes, int index)
+{
+    const WindowTreeNode &node = nodes.at(index);
+
+    if (node.check.viewable && node.check.relevant)
+        return node.window;
+
+    // Like the Xlib implementation, the relevance of the parent is checked here.
+    for (int child : node.children)
+    {
+        if (nodes.at(child).check.viewable && node.check.relevant)
+            return nodes.at(child).window;
+    }
+
+    for (int child : node.children)
+    {
+        Window result = searchClientWindow(nodes, child);
+        if (result != 0)
+            return result;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief XCB implementation of findClientWindow(). The window tree below the
+ *     given window is fetched level by level with all requests of a level
+ *     sent at once, so the search costs one round trip per tree level.
+ *     The children are not walked if the given window is a client window.
+ */
+Window findClientWindowBatched(Display *display, Window window)
+{
+    xcb_connection_t *connection = XGetXCBConnection(display);
+    xcb_atom_t atoms[3];
+    getRelevantAtoms(display, atoms);
+
+    QVector<WindowTreeNode> nodes;
+    nodes.append({static_cast<xcb_window_t>(window), {false, false}, {}});
+    QVector<int> level = {0};
+
+    while (!level.isEmpty())
+    {
+        QVector<WindowCheck> checks;
+        QVector<xcb_query_tree_cookie_t> trees;
+
+        for (int index : level)
+        {
+            checks.append(requestWindowCheck(connection, nodes.at(index).window, atoms));
+            trees.append(xcb_query_tree(connection, nodes.at(index).window));
+        }
+
+        QVector<int> nextLevel;
+
+        for (int i = 0; i < level.size(); i++)
+        {
+            int index = level.at(i);
+            nodes[index].check = collectWindowCheck(connection, checks.at(i));
+
+            xcb_generic_error_t *error = nullptr;
+            xcb_query_tree_reply_t *tree = xcb_query_tree_reply(connection, trees.at(i), &error);
+            free(error);
+
+            if (tree == nullptr)
+                continue;
+
+            xcb_window_t *children = xcb_query_tree_children(tree);
+            int numChildren = xcb_query_tree_children_length(tree);
+
+            for (int j = 0; j < numChildren; j++)
+            {
+                nodes[index].children.append(nodes.size());
+                nextLevel.append(nodes.size());
+                nodes.append({children[j], {false, false}, {}});
+            }
+
+            free(tree);
+        }
+
+        // The starting window is often the client window itself.
+        if (nodes.at(0).check.viewable && nodes.at(0).check.relevant)
+            return nodes.at(0).window;
+
+        level = nextLevel;
+    }
+
+    return searchClientWindow(nodes, 0);
+}
+
+} // namespace
+
+#endif
+
 Window X11Extras::findParentClient(Window window)
 {
+#ifdef WITH_XCB
+    if (display() != nullptr)
+        return findParentClientBatched(display(), window);
+#endif
+
     Window parent = 0;
     Window root = 0;
     Window *children = 0;
@@ -374,6 +633,11 @@ QString X11Extras::getApplicationLocation(int pid)
  */
 Window X11Extras::findClientWindow(Window window)
 {
+#ifdef WITH_XCB
+    if (display() != nullptr)
+        return findClientWindowBatched(display(), window);
+#endif
+
     Window parent = 1;
     Window root = 0;
     Window *children = nullptr;
@@ -596,6 +860,251 @@ unsigned long X11Extras::getWindowInFocus()
     return result;
 }
 
+/**
+ * @brief Get the file descriptor of the X display connection. It becomes
+ *     readable when the X server sends events.
+ * @return File descriptor or -1 without a display.
+ */
+int X11Extras::getConnectionNumber() { return (display() != nullptr) ? ConnectionNumber(display()) : -1; }
+
+/**
+ * @brief Check whether the window manager publishes the active window
+ *     using the EWMH _NET_ACTIVE_WINDOW root window property.
+ */
+bool X11Extras::isActiveWindowHintSupported()
+{
+    bool result = false;
+    Display *display = this->display();
+
+    if (display == nullptr)
+        return result;
+
+    Atom net_supported = XInternAtom(display, "_NET_SUPPORTED", True);
+    Atom net_active_window = XInternAtom(display, "_NET_ACTIVE_WINDOW", True);
+
+    if ((net_supported == None) || (net_active_window == None))
+        return result;
+
+    Atom actual_type;
+    int actual_format = 0;
+    unsigned long nitems = 0;
+    unsigned long bytes_after = 0;
+    unsigned char *prop = nullptr;
+    int status = XGetWindowProperty(display, appRootWindow(), net_supported, 0, 4096, false, XA_ATOM, &actual_type,
+                                    &actual_format, &nitems, &bytes_after, &prop);
+
+    if ((status == Success) && (prop != nullptr) && (actual_format == 32))
+    {
+        Atom *atoms = reinterpret_cast<Atom *>(prop);
+
+        for (unsigned long i = 0; i < nitems; i++)
+        {
+            if (atoms[i] == net_active_window)
+            {
+                result = true;
+                break;
+            }
+        }
+    }
+
+    freeWindow(prop);
+
+    return result;
+}
+
+/**
+ * @brief Get the active client window from the _NET_ACTIVE_WINDOW
+ *     root window property.
+ * @return XID of the window or 0 if no window is active.
+ */
+unsigned long X11Extras::getActiveWindow()
+{
+    unsigned long result = 0;
+    Display *display = this->display();
+    Atom net_active_window = XInternAtom(display, "_NET_ACTIVE_WINDOW", True);
+
+    if (net_active_window == None)
+        return result;
+
+    Atom actual_type;
+    int actual_format = 0;
+    unsigned long nitems = 0;
+    unsigned long bytes_after = 0;
+    unsigned char *prop = nullptr;
+    int status = XGetWindowProperty(display, appRootWindow(), net_active_window, 0, 1, false, XA_WINDOW, &actual_type,
+                                    &actual_format, &nitems, &bytes_after, &prop);
+
+    if ((status == Success) && (prop != nullptr) && (nitems > 0) && (actual_format == 32))
+        result = *reinterpret_cast<Window *>(prop);
+
+    freeWindow(prop);
+
+    return result;
+}
+
+/**
+ * @brief Subscribe to or unsubscribe from PropertyNotify events of a window.
+ *     A checked request is used, so errors for windows which were destroyed
+ *     in the meantime are returned to the caller instead of reaching the
+ *     Xlib error handler. Does nothing without XCB support.
+ * @param Window to change the event mask of
+ * @param Whether to receive PropertyNotify events for the window
+ */
+void X11Extras::selectPropertyEvents(Window window, bool enable)
+{
+#ifdef WITH_XCB
+    Display *display = this->display();
+
+    if ((display == nullptr) || (window == None))
+        return;
+
+    xcb_connection_t *connection = XGetXCBConnection(display);
+    uint32_t mask = enable ? XCB_EVENT_MASK_PROPERTY_CHANGE : XCB_EVENT_MASK_NO_EVENT;
+    xcb_void_cookie_t cookie =
+        xcb_change_window_attributes_checked(connection, static_cast<xcb_window_t>(window), XCB_CW_EVENT_MASK, &mask);
+
+    free(xcb_request_check(connection, cookie));
+#else
+    Q_UNUSED(window);
+    Q_UNUSED(enable);
+#endif
+}
+
+/**
+ * @brief Consume all pending events of the display connection and check
+ *     them for a change of the active window or of the title of the
+ *     watched window. Never blocks.
+ * @param Window whose title changes are of interest
+ * @return Combination of WindowChange flags
+ */
+int X11Extras::readWindowChanges(Window watchedWindow)
+{
+    int result = NoWindowChange;
+    Display *display = this->display();
+
+    if (display == nullptr)
+        return result;
+
+    Window root = appRootWindow();
+    Atom net_active_window = XInternAtom(display, "_NET_ACTIVE_WINDOW", True);
+    Atom wm_name = XInternAtom(display, "WM_NAME", True);
+    Atom net_wm_name = XInternAtom(display, "_NET_WM_NAME", True);
+
+    while (XPending(display) > 0)
+    {
+        XEvent event;
+        XNextEvent(display, &event);
+
+        if (event.type != PropertyNotify)
+            continue;
+
+        const XPropertyEvent &property = event.xproperty;
+
+        if ((property.window == root) && (property.atom == net_active_window))
+        {
+            result |= ActiveWindowChanged;
+        } else if ((property.window == watchedWindow) && ((property.atom == wm_name) || (property.atom == net_wm_name)))
+        {
+            result |= WindowTitleChanged;
+
+            for (WindowInfo &info : windowInfoCache)
+            {
+                if (info.clientWindow == property.window)
+                    info.titleValid = false;
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Resolve the client window, PID, executable path, class and title of
+ *     a focused window. Results are cached per window, so checking the same
+ *     window again needs neither X requests nor system calls. When the focus
+ *     returns to a cached window, the start time of its process is compared
+ *     to detect a reused window or PID. The title is queried again as well,
+ *     since title changes are only reported while a window is watched.
+ * @param Window in focus
+ * @param Whether to query the title again. Title changes of the window
+ *     passed to readWindowChanges() invalidate the cached title anyway.
+ * @return Cached information about the window
+ */
+const X11Extras::WindowInfo &X11Extras::getWindowInfo(Window window, bool refreshTitle)
+{
+    auto iter = windowInfoCache.find(window);
+    bool valid = (iter != windowInfoCache.end());
+    bool focusChanged = (window != lastInfoWindow);
+
+    if (valid && focusChanged)
+        valid = (iter->pid <= 0) || (getProcessStartTime(iter->pid) == iter->processStartTime);
+
+    lastInfoWindow = window;
+
+    if (valid)
+    {
+        windowInfoCacheHits++;
+    } else
+    {
+        windowInfoCacheMisses++;
+
+        if (windowInfoCache.size() >= GlobalVariables::X11Extras::WINDOWINFOCACHESIZE)
+            windowInfoCache.clear();
+
+        WindowInfo info;
+        Window client = findParentClient(window);
+        info.clientWindow = (client > 0) ? client : window;
+        info.pid = getApplicationPid(window);
+        info.processStartTime = getProcessStartTime(info.pid);
+        info.exePath = getApplicationLocation(info.pid);
+        info.windowClass = getWindowClass(info.clientWindow);
+        info.titleValid = false;
+
+        iter = windowInfoCache.insert(window, info);
+    }
+
+    if (refreshTitle || focusChanged || !iter->titleValid)
+    {
+        iter->title = getWindowTitle(iter->clientWindow);
+        iter->titleValid = true;
+    }
+
+    return iter.value();
+}
+
+/**
+ * @brief Read the start time of a process. Together with the PID, it
+ *     identifies a process even if the PID is reused later.
+ * @param PID of the process
+ * @return Start time in clock ticks since boot or -1 if unknown
+ */
+qint64 X11Extras::getProcessStartTime(int pid)
+{
+    if (pid <= 0)
+        return -1;
+
+    QFile statFile(QString("/proc/%1/stat").arg(pid));
+    if (!statFile.open(QIODevice::ReadOnly))
+        return -1;
+
+    QByteArray stat = statFile.readAll();
+
+    // The command name may contain spaces, so fields are counted from its closing parenthesis.
+    int commandEnd = stat.lastIndexOf(')');
+    if (commandEnd < 0)
+        return -1;
+
+    // starttime is field 22 and the list starts with field 3.
+    QList<QByteArray> fields = stat.mid(commandEnd + 2).split(' ');
+    if (fields.size() < 20)
+        return -1;
+
+    bool ok = false;
+    qint64 startTime = fields.at(19).toLongLong(&ok);
+
+    return ok ? startTime : -1;
+}
+
 /**
  * @brief Get QString representation of currently utilized X display.
  * @return
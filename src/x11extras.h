@@ -31,6 +31,30 @@ class X11Extras : public QObject
     Q_OBJECT
 
   public:
+    /**
+     * @brief Window changes reported by readWindowChanges().
+     */
+    enum WindowChange
+    {
+        NoWindowChange = 0,
+        ActiveWindowChanged = 1 << 0,
+        WindowTitleChanged = 1 << 1
+    };
+
+    /**
+     * @brief Properties of a focused window resolved by getWindowInfo().
+     */
+    struct WindowInfo
+    {
+        Window clientWindow;
+        int pid;
+        qint64 processStartTime;
+        QString exePath;
+        QString windowClass;
+        QString title;
+        bool titleValid;
+    };
+
     struct ptrInformation
     {
         long id;
@@ -62,6 +86,15 @@ class X11Extras : public QObject
     QString getWindowTitle(Window window);
     QString getWindowClass(Window window);
     unsigned long getWindowInFocus();
+    int getConnectionNumber();
+    bool isActiveWindowHintSupported();
+    unsigned long getActiveWindow();
+    void selectPropertyEvents(Window window, bool enable);
+    int readWindowChanges(Window watchedWindow);
+    const WindowInfo &getWindowInfo(Window window, bool refreshTitle);
+
+    inline quint64 getWindowInfoCacheHits() const { return windowInfoCacheHits; }
+    inline quint64 getWindowInfoCacheMisses() const { return windowInfoCacheMisses; }
     int getGroup1KeySym(int virtualkey);
 
     void x11ResetMouseAccelerationChange();
@@ -95,12 +128,18 @@ class X11Extras : public QObject
     void checkPropertyOnWin(bool windowCorrected, Window &window, Window &parent, Window &finalwindow, Window &root,
                             Window *children, Display *display, unsigned int &num_children);
     void freeDisplay();
+    static qint64 getProcessStartTime(int pid);
     void checkFeedback(XFeedbackState *temp, int &num_feedbacks, int &feedback_id);
     void findVirtualPtr(int num_devices, XIDeviceInfo *current_devices, XIDeviceInfo *mouse_device,
                         XIDeviceInfo *all_devices, QString pointerName);
 
     QHash<QString, QString> knownAliases;
     Display *_display;
+
+    QHash<Window, WindowInfo> windowInfoCache;
+    Window lastInfoWindow;
+    quint64 windowInfoCacheHits;
+    quint64 windowInfoCacheMisses;
 };
 
 #endif // X11EXTRAS_H
@@ -21,6 +21,7 @@
 #include "joybuttontypes/joysensorbutton.h"
 #include "joycontrolstick.h"
 #include "joysensor.h"
+#include "profilereader.h"
 #include "vdpad.h"
 
 #include "common.h"
@@ -28,7 +29,6 @@
 #include "logger.h"
 
 #include <QDebug>
-#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
 InputDeviceXml::InputDeviceXml(InputDevice *inputDevice, QObject *parent)
@@ -44,7 +44,7 @@ InputDeviceXml::InputDeviceXml(InputDevice *inputDevice, QObject *parent)
  * @brief Deserializes the given XML stream into an InputDevice object
  * @param[in] xml The XML stream to read from
  */
-void InputDeviceXml::readConfig(QXmlStreamReader *xml)
+void InputDeviceXml::readConfig(ProfileReader *xml)
 {
     m_mutex_read_config.try_lock();
     // reading of config should be handled in inputEventThread
@@ -521,7 +521,7 @@ void InputDeviceXml::writeConfig(QXmlStreamWriter *xml)
         }
 
         // write axes of joystick
-        QListIterator<JoyAxis *> currentAxis(m_inputDevice->getActiveSetJoystick()->getAxes()->values());
+        QListIterator<JoyAxis *> currentAxis(m_inputDevice->getActiveSetJoystick()->getAxes().values());
         while (currentAxis.hasNext())
         {
             JoyAxis *axis = currentAxis.next();
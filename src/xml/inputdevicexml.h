@@ -21,7 +21,7 @@
 #include <QMutex>
 #include <QObject>
 
-class QXmlStreamReader;
+class ProfileReader;
 class QXmlStreamWriter;
 class InputDevice;
 class AntiMicroSettings;
@@ -29,7 +29,7 @@ class AntiMicroSettings;
 /**
  * @brief Generic InputDevice XML serialization/deserialization helper class
  *  Reads data from the supplied InputDevice object and writes it to XML or
- *  reads data from an QXmlStreamReader and writes it to the InputDevice object.
+ *  reads data from a ProfileReader and writes it to the InputDevice object.
  *
  *  After serializing or deserializing the device data, it reads/writes
  *  all SetJoysticks.
@@ -42,11 +42,11 @@ class InputDeviceXml : public QObject
 
   public slots:
 
-    void readConfig(QXmlStreamReader *xml);  // InputDeviceXml class
+    void readConfig(ProfileReader *xml);     // InputDeviceXml class
     void writeConfig(QXmlStreamWriter *xml); // InputDeviceXml class
 
   signals:
-    void readConfigSig(QXmlStreamReader *xml);
+    void readConfigSig(ProfileReader *xml);
 
   private:
     InputDevice *m_inputDevice;
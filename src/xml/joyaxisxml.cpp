@@ -20,10 +20,10 @@
 #include "inputdevice.h"
 #include "joyaxis.h"
 #include "joybuttontypes/joyaxisbutton.h"
+#include "profilereader.h"
 #include "xml/joybuttonxml.h"
 
 #include <QDebug>
-#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
 JoyAxisXml::JoyAxisXml(JoyAxis *axis, QObject *parent)
@@ -42,7 +42,7 @@ JoyAxisXml::~JoyAxisXml()
         joyButtonXmlPAxis->deleteLater();
 }
 
-void JoyAxisXml::readConfig(QXmlStreamReader *xml)
+void JoyAxisXml::readConfig(ProfileReader *xml)
 {
     if (xml->isStartElement() && (xml->name() == m_joyAxis->getXmlName()))
     {
@@ -80,6 +80,24 @@ void JoyAxisXml::writeConfig(QXmlStreamWriter *xml)
 
         if (m_joyAxis->getMaxZoneValue() != GlobalVariables::JoyAxis::AXISMAXZONE)
             xml->writeTextElement("maxZone", QString::number(m_joyAxis->getMaxZoneValue()));
+
+        const JoyAxisCurve &curve = m_joyAxis->getResponseCurve();
+
+        if (!curve.isEmpty())
+        {
+            xml->writeStartElement("responseCurve");
+            xml->writeAttribute("spline", curve.spline ? "true" : "false");
+
+            for (const QPointF &point : curve.points)
+            {
+                xml->writeStartElement("point");
+                xml->writeAttribute("x", QString::number(point.x()));
+                xml->writeAttribute("y", QString::number(point.y()));
+                xml->writeEndElement();
+            }
+
+            xml->writeEndElement();
+        }
     }
 
     xml->writeStartElement("throttle");
@@ -124,7 +142,7 @@ void JoyAxisXml::writeConfig(QXmlStreamWriter *xml)
     xml->writeEndElement();
 }
 
-bool JoyAxisXml::readMainConfig(QXmlStreamReader *xml)
+bool JoyAxisXml::readMainConfig(ProfileReader *xml)
 {
     bool found = false;
 
@@ -146,6 +164,25 @@ bool JoyAxisXml::readMainConfig(QXmlStreamReader *xml)
         qDebug() << "From xml config max zone is: " << tempchoice;
 
         m_joyAxis->setMaxZoneValue(tempchoice);
+    } else if ((xml->name() == "responseCurve") && xml->isStartElement())
+    {
+        found = true;
+        JoyAxisCurve curve;
+        curve.spline = (xml->attributes().value("spline") == QLatin1String("true"));
+
+        while (xml->readNextStartElement())
+        {
+            if (xml->name() == "point")
+            {
+                QXmlStreamAttributes attributes = xml->attributes();
+                curve.points.append(
+                    QPointF(attributes.value("x").toString().toDouble(), attributes.value("y").toString().toDouble()));
+            }
+
+            xml->skipCurrentElement();
+        }
+
+        m_joyAxis->setResponseCurve(curve);
     } else if ((xml->name() == "throttle") && xml->isStartElement())
     {
         found = true;
@@ -189,7 +226,7 @@ bool JoyAxisXml::readMainConfig(QXmlStreamReader *xml)
     return found;
 }
 
-bool JoyAxisXml::readButtonConfig(QXmlStreamReader *xml)
+bool JoyAxisXml::readButtonConfig(ProfileReader *xml)
 {
     bool found = false;
 
@@ -23,7 +23,7 @@
 
 class JoyAxis;
 class JoyButtonXml;
-class QXmlStreamReader;
+class ProfileReader;
 class QXmlStreamWriter;
 
 class JoyAxisXml : public QObject
@@ -34,11 +34,11 @@ class JoyAxisXml : public QObject
     explicit JoyAxisXml(JoyAxis *axis, QObject *parent = nullptr);
     ~JoyAxisXml();
 
-    virtual void readConfig(QXmlStreamReader *xml);
+    virtual void readConfig(ProfileReader *xml);
     virtual void writeConfig(QXmlStreamWriter *xml);
 
-    virtual bool readMainConfig(QXmlStreamReader *xml);
-    virtual bool readButtonConfig(QXmlStreamReader *xml);
+    virtual bool readMainConfig(ProfileReader *xml);
+    virtual bool readButtonConfig(ProfileReader *xml);
 
   private:
     JoyAxis *m_joyAxis;
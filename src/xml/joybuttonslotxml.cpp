@@ -19,10 +19,11 @@
 #include "antkeymapper.h"
 #include "globalvariables.h"
 #include "joybuttonslot.h"
+#include "profilepool.h"
+#include "profilereader.h"
 
 #include <QDebug>
 #include <QFileInfo>
-#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
 int JoyButtonSlotXml::timeoutWrite = 5000;
@@ -34,7 +35,7 @@ JoyButtonSlotXml::JoyButtonSlotXml(JoyButtonSlot *joyBtnSlot, QObject *parent)
 {
 }
 
-void JoyButtonSlotXml::readConfig(QXmlStreamReader *xml)
+void JoyButtonSlotXml::readConfig(ProfileReader *xml)
 { // QWriteLocker tempLocker(&xmlLock);
     std::chrono::time_point<std::chrono::high_resolution_clock> t1, t2;
     t1 = std::chrono::high_resolution_clock::now();
@@ -145,8 +146,8 @@ void JoyButtonSlotXml::readConfig(QXmlStreamReader *xml)
         timeoutRead = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
 }
 
-void JoyButtonSlotXml::readEachSlot(QXmlStreamReader *xml, JoyButtonSlot *joyBtnSlot, QString &profile,
-                                    QString &tempStringData, QString &extraStringData)
+void JoyButtonSlotXml::readEachSlot(ProfileReader *xml, JoyButtonSlot *joyBtnSlot, QString &profile, QString &tempStringData,
+                                    QString &extraStringData)
 {
     while (!xml->atEnd() && (!xml->isEndElement() && (xml->name() != "slot")))
     {
@@ -267,6 +268,7 @@ void JoyButtonSlotXml::setSlotData(JoyButtonSlot *joyBtnSlot, QString profile, Q
         } else
         {
             joyBtnSlot->setTextData(profile);
+            ProfilePool::getInstance()->preload(profile);
         }
     } else if (joyBtnSlot->getSlotMode() == JoyButtonSlot::JoySetChange && !(joyBtnSlot->getSlotCode() >= 0) &&
                !(joyBtnSlot->getSlotCode() < GlobalVariables::InputDevice::NUMBER_JOYSETS))
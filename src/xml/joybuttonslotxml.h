@@ -21,7 +21,7 @@
 #include <QObject>
 #include <QReadWriteLock>
 
-class QXmlStreamReader;
+class ProfileReader;
 class QXmlStreamWriter;
 class JoyButtonSlot;
 
@@ -32,14 +32,14 @@ class JoyButtonSlotXml : public QObject
   public:
     explicit JoyButtonSlotXml(JoyButtonSlot *joyBtnSlot, QObject *parent = nullptr);
 
-    virtual void readConfig(QXmlStreamReader *xml);
+    virtual void readConfig(ProfileReader *xml);
     virtual void writeConfig(QXmlStreamWriter *xml);
     static int timeoutWrite;
     static int timeoutRead;
 
   private:
     void writeEachSlot(QXmlStreamWriter *xml, JoyButtonSlot *joyBtnSlot);
-    void readEachSlot(QXmlStreamReader *xml, JoyButtonSlot *joyBtnSlot, QString &profile, QString &tempStringData,
+    void readEachSlot(ProfileReader *xml, JoyButtonSlot *joyBtnSlot, QString &profile, QString &tempStringData,
                       QString &extraStringData);
     void setSlotData(JoyButtonSlot *joyBtnSlot, QString profile, QString tempStringData, QString extraStringData);
 
@@ -18,9 +18,9 @@
 #include "joybuttonxml.h"
 #include "joybuttonslotxml.h"
 #include "joybuttontypes/joybutton.h"
+#include "profilereader.h"
 
 #include <QDebug>
-#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
 JoyButtonXml::JoyButtonXml(JoyButton *joyButton, QObject *parent)
@@ -29,7 +29,7 @@ JoyButtonXml::JoyButtonXml(JoyButton *joyButton, QObject *parent)
     m_joyButton = joyButton;
 }
 
-bool JoyButtonXml::readButtonConfig(QXmlStreamReader *xml)
+bool JoyButtonXml::readButtonConfig(ProfileReader *xml)
 {
     bool found = false;
 
@@ -319,10 +319,11 @@ bool JoyButtonXml::readButtonConfig(QXmlStreamReader *xml)
     return found;
 }
 
-void JoyButtonXml::readConfig(QXmlStreamReader *xml)
+void JoyButtonXml::readConfig(ProfileReader *xml)
 {
     if (xml->isStartElement() && (xml->name() == m_joyButton->getXmlName()))
     {
+        bool changed = false;
         xml->readNextStartElement();
 
         while (!xml->atEnd() && (!xml->isEndElement() && (xml->name() != m_joyButton->getXmlName())))
@@ -332,10 +333,14 @@ void JoyButtonXml::readConfig(QXmlStreamReader *xml)
             if (!found)
                 xml->skipCurrentElement();
             else
-                m_joyButton->buildActiveZoneSummaryString();
+                changed = true;
 
             xml->readNextStartElement();
         }
+
+        // Build the summary once per button instead of once per property.
+        if (changed)
+            m_joyButton->buildActiveZoneSummaryString();
     }
 }
 
@@ -21,7 +21,7 @@
 #include <QObject>
 
 class JoyButton;
-class QXmlStreamReader;
+class ProfileReader;
 class QXmlStreamWriter;
 
 class JoyButtonXml : public QObject
@@ -31,8 +31,8 @@ class JoyButtonXml : public QObject
   public:
     explicit JoyButtonXml(JoyButton *joyButton, QObject *parent = nullptr);
 
-    virtual bool readButtonConfig(QXmlStreamReader *xml);
-    virtual void readConfig(QXmlStreamReader *xml);
+    virtual bool readButtonConfig(ProfileReader *xml);
+    virtual void readConfig(ProfileReader *xml);
     virtual void writeConfig(QXmlStreamWriter *xml);
 
   private:
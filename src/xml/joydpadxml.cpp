@@ -4,13 +4,13 @@
 
 #include "gamecontroller/gamecontrollerdpad.h"
 #include "joydpad.h"
+#include "profilereader.h"
 #include "vdpad.h"
 #include "xml/joybuttonxml.h"
 
 #include <QDebug>
 #include <QHashIterator>
 #include <QPointer>
-#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
 template <class T>
@@ -20,7 +20,7 @@ JoyDPadXml<T>::JoyDPadXml(T *joydpad, QObject *parent)
     m_joydpad = joydpad;
 }
 
-template <class T> void JoyDPadXml<T>::readConfig(QXmlStreamReader *xml)
+template <class T> void JoyDPadXml<T>::readConfig(ProfileReader *xml)
 {
     if (xml->isStartElement() && (xml->name() == m_joydpad->getXmlName()))
     {
@@ -73,7 +73,7 @@ template <class T> void JoyDPadXml<T>::writeConfig(QXmlStreamWriter *xml)
     }
 }
 
-template <class T> bool JoyDPadXml<T>::readMainConfig(QXmlStreamReader *xml)
+template <class T> bool JoyDPadXml<T>::readMainConfig(ProfileReader *xml)
 {
     bool found = false;
 
@@ -20,7 +20,7 @@
 
 #include <QObject>
 
-class QXmlStreamReader;
+class ProfileReader;
 class QXmlStreamWriter;
 
 template <class T> class JoyDPadXml : public QObject
@@ -28,9 +28,9 @@ template <class T> class JoyDPadXml : public QObject
   public:
     explicit JoyDPadXml(T *joydpad, QObject *parent = nullptr);
 
-    void readConfig(QXmlStreamReader *xml);  // JoyDPadXml class
+    void readConfig(ProfileReader *xml);     // JoyDPadXml class
     void writeConfig(QXmlStreamWriter *xml); // JoyDPadXml class
-    bool readMainConfig(QXmlStreamReader *xml);
+    bool readMainConfig(ProfileReader *xml);
 
   private:
     T *m_joydpad;
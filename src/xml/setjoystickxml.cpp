@@ -27,13 +27,13 @@
 #include "joycontrolstick.h"
 #include "joydpad.h"
 #include "joysensor.h"
+#include "profilereader.h"
 #include "vdpad.h"
 
 #include "setjoystick.h"
 
 #include <QDebug>
 #include <QFuture>
-#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 #include <QtConcurrent/QtConcurrent>
 
@@ -47,7 +47,7 @@ SetJoystickXml::SetJoystickXml(SetJoystick *setJoystick, QObject *parent)
  * @brief Deserializes the given XML stream into a SetJoystick object
  * @param[in] xml The XML stream to read from
  */
-void SetJoystickXml::readConfig(QXmlStreamReader *xml)
+void SetJoystickXml::readConfig(ProfileReader *xml)
 {
     if (xml->isStartElement() && (xml->name() == "set"))
     {
@@ -170,7 +170,7 @@ void SetJoystickXml::writeConfig(QXmlStreamWriter *xml)
             joydpadXml = nullptr;
         }
 
-        QList<JoyAxis *> axesList = m_setJoystick->getAxes()->values();
+        QList<JoyAxis *> axesList = m_setJoystick->getAxes().values();
         QListIterator<JoyAxis *> axis(axesList);
         while (axis.hasNext())
         {
@@ -23,13 +23,13 @@
 class SetJoystick;
 class JoyAxisXml;
 class JoyButtonXml;
-class QXmlStreamReader;
+class ProfileReader;
 class QXmlStreamWriter;
 
 /**
  * @brief SetJoystick XML serialization/deserialization helper class
  *  Reads data from the supplied SetJoystick object and writes it to XML or
- *  reads data from an QXmlStreamReader and writes it to the SetJoystick object.
+ *  reads data from a ProfileReader and writes it to the SetJoystick object.
  */
 class SetJoystickXml : public QObject
 {
@@ -38,7 +38,7 @@ class SetJoystickXml : public QObject
   public:
     explicit SetJoystickXml(SetJoystick *setJoystick, QObject *parent = nullptr);
 
-    virtual void readConfig(QXmlStreamReader *xml);
+    virtual void readConfig(ProfileReader *xml);
     virtual void writeConfig(QXmlStreamWriter *xml);
 
   private:
@@ -22,6 +22,10 @@
 #include "globalvariables.h"
 #include "inputdevice.h"
 #include "joystick.h"
+#include "profilecache.h"
+#include "profilepool.h"
+#include "profilereader.h"
+#include "profilesaver.h"
 #include "xml/inputdevicexml.h"
 #include "xmlconfigmigration.h"
 #include "xmlconfigwriter.h"
@@ -31,6 +35,7 @@
 
 #include <QDebug>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QStringList>
 #include <QXmlStreamReader>
@@ -42,6 +47,7 @@ XMLConfigReader::XMLConfigReader(QObject *parent)
     : QObject(parent)
 {
     xml = new QXmlStreamReader();
+    m_reader = nullptr;
     configFile = nullptr;
     m_joystick = nullptr;
     initDeviceTypes();
@@ -63,6 +69,8 @@ XMLConfigReader::~XMLConfigReader()
         delete xml;
         xml = nullptr;
     }
+
+    delete m_reader;
 }
 
 void XMLConfigReader::setJoystick(InputDevice *joystick) { m_joystick = joystick; }
@@ -100,63 +108,63 @@ bool XMLConfigReader::read()
 
     if ((configFile != nullptr) && configFile->exists() && (m_joystick != nullptr))
     {
+        QElapsedTimer loadTimer;
+        loadTimer.start();
         xml->clear();
 
-        if (!configFile->isOpen())
+        // Preloaded profiles are already parsed, so switching to them neither
+        // waits for storage nor for the parser. Freshly parsed profiles are
+        // pooled, so they can be switched back to fast.
+        ProfileSaver::getInstance()->waitForPending(configFile->fileName());
+        QSharedPointer<const ProfileImage> image = ProfilePool::getInstance()->lookup(configFile->fileName());
+
+        if (image.isNull())
         {
-            if (configFile->open(QFile::ReadOnly | QFile::Text))
-                xml->setDevice(configFile);
-            else
+            ProfilePool::Stamp stamp = ProfilePool::Stamp::of(configFile->fileName());
+            QByteArray contents;
+
+            if (configFile->isOpen() || configFile->open(QFile::ReadOnly | QFile::Text))
+            {
+                contents = configFile->readAll();
+                configFile->close();
+            } else
+            {
                 WARN() << "Could not open file: " << configFile->fileName();
-        }
+            }
 
-        xml->readNextStartElement();
+            image = ProfileCache::getInstance()->load(configFile->fileName(), contents);
 
-        if (!deviceTypes.contains(xml->name().toString()))
-        {
-            xml->raiseError("Root node is not a joystick or controller");
-        } else if (xml->name() == GlobalVariables::Joystick::xmlName)
+            if (image.isNull())
+                image = parse(contents);
+
+            if (!xml->hasError())
+                ProfilePool::getInstance()->store(configFile->fileName(), stamp, image);
+        }
+
+        if (!image.isNull())
         {
-            XMLConfigMigration migration(xml);
+            delete m_reader;
+            m_reader = new ProfileReader(image);
+            m_reader->readNextStartElement();
 
-            if (migration.requiresMigration())
+            while (!m_reader->atEnd())
             {
-                QString migrationString = migration.migrate();
-
-                if (migrationString.length() > 0)
+                if (m_reader->isStartElement() && deviceTypes.contains(m_reader->name().toString()))
+                {
+                    InputDeviceXml *joystick_xml = new InputDeviceXml(m_joystick);
+                    joystick_xml->readConfig(m_reader);
+                    joystick_xml->deleteLater();
+                } else
                 {
-                    xml->clear();                                     // Remove QFile from reader and clear state
-                    xml->addData(migrationString);                    // Add converted XML string to reader
-                    xml->readNextStartElement();                      // Skip joystick root node
-                    configFile->close();                              // Close current config file
-                    configFile->open(QFile::WriteOnly | QFile::Text); // Write converted XML to file
-
-                    if (configFile->isOpen())
-                    {
-                        configFile->write(migrationString.toLocal8Bit());
-                        configFile->close();
-                    } else
-                    {
-                        xml->raiseError(tr("Could not write updated profile XML to file %1.").arg(configFile->fileName()));
-                    }
+                    // If none of the above, skip the element
+                    m_reader->skipCurrentElement();
                 }
-            }
-        }
 
-        while (!xml->atEnd())
-        {
-            if (xml->isStartElement() && deviceTypes.contains(xml->name().toString()))
-            {
-                InputDeviceXml *joystick_xml = new InputDeviceXml(m_joystick);
-                joystick_xml->readConfig(xml);
-                joystick_xml->deleteLater();
-            } else
-            {
-                // If none of the above, skip the element
-                xml->skipCurrentElement();
+                m_reader->readNextStartElement();
             }
 
-            xml->readNextStartElement();
+            if (m_reader->hasError() && !xml->hasError())
+                xml->raiseError(m_reader->errorString());
         }
 
         if (configFile->isOpen())
@@ -169,11 +177,76 @@ bool XMLConfigReader::read()
         {
             xml->clear();
         }
+
+        DEBUG() << "Read profile " << configFile->fileName() << " in " << loadTimer.elapsed() << " ms";
     }
 
     return error;
 }
 
+/**
+ * @brief Parses the XML contents of the config file and migrates old
+ *  profiles. Successfully parsed profiles are added to the profile cache.
+ * @returns Image of the parsed profile, which ends at the first error, or a
+ *  null pointer if there is nothing to read.
+ */
+QSharedPointer<const ProfileImage> XMLConfigReader::parse(const QByteArray &contents)
+{
+    bool migrated = false;
+
+    m_buffer.close();
+    m_buffer.setData(contents);
+    m_buffer.open(QBuffer::ReadOnly | QBuffer::Text);
+    xml->setDevice(&m_buffer);
+
+    xml->readNextStartElement();
+
+    if (!deviceTypes.contains(xml->name().toString()))
+    {
+        xml->raiseError("Root node is not a joystick or controller");
+    } else if (xml->name() == GlobalVariables::Joystick::xmlName)
+    {
+        XMLConfigMigration migration(xml);
+
+        if (migration.requiresMigration())
+        {
+            QString migrationString = migration.migrate();
+
+            if (migrationString.length() > 0)
+            {
+                migrated = true;
+                xml->clear();                                     // Remove QFile from reader and clear state
+                xml->addData(migrationString);                    // Add converted XML string to reader
+                xml->readNextStartElement();                      // Skip joystick root node
+                configFile->close();                              // Close current config file
+                configFile->open(QFile::WriteOnly | QFile::Text); // Write converted XML to file
+                ProfilePool::getInstance()->invalidate(configFile->fileName());
+
+                if (configFile->isOpen())
+                {
+                    configFile->write(migrationString.toLocal8Bit());
+                    configFile->close();
+                } else
+                {
+                    xml->raiseError(tr("Could not write updated profile XML to file %1.").arg(configFile->fileName()));
+                }
+            }
+        }
+    }
+
+    if (xml->hasError())
+        return QSharedPointer<const ProfileImage>();
+
+    QSharedPointer<const ProfileImage> image = ProfileImage::fromXml(xml);
+
+    // A migrated profile is cached the next time it is read, as the cache
+    // is keyed by the contents of the file.
+    if (!migrated && !xml->hasError())
+        ProfileCache::getInstance()->store(configFile->fileName(), contents, image);
+
+    return image;
+}
+
 const QString XMLConfigReader::getErrorString()
 {
     QString temp = QString();
@@ -19,10 +19,14 @@
 #ifndef XMLCONFIGREADER_H
 #define XMLCONFIGREADER_H
 
+#include <QBuffer>
 #include <QObject>
+#include <QSharedPointer>
 #include <QStringList>
 
 class InputDevice;
+class ProfileImage;
+class ProfileReader;
 class QXmlStreamReader;
 class InputDeviceXml;
 class QFile;
@@ -51,14 +55,19 @@ class XMLConfigReader : public QObject
 
   protected:
     void initDeviceTypes();
+    QSharedPointer<const ProfileImage> parse(const QByteArray &contents);
 
   public slots:
     void configJoystick(InputDevice *joystick);
 
   private:
     QXmlStreamReader *xml;
+    // Reads the profile image into the input device.
+    ProfileReader *m_reader;
     QString fileName;
     QFile *configFile;
+    // Contents of the config file the XML stream is read from.
+    QBuffer m_buffer;
     InputDevice *m_joystick;
     QStringList deviceTypes;
 };
@@ -20,8 +20,10 @@
 
 #include "common.h"
 #include "inputdevice.h"
+#include "profilesaver.h"
 #include "xml/inputdevicexml.h"
 
+#include <QBuffer>
 #include <QDebug>
 #include <QDir>
 #include <QFile>
@@ -57,32 +59,35 @@ XMLConfigWriter::~XMLConfigWriter()
 }
 
 /**
- * @brief Write input device config from the current object into XML file
+ * @brief Write input device config from the current object into XML file.
+ *  The config is serialized into memory right away and written to disk
+ *  by the ProfileSaver worker, which reports write errors asynchronously.
  * @param[in] joystickXml InputDeviceXml which gets serialized
  */
 void XMLConfigWriter::write(InputDeviceXml *joystickXml)
 {
     writerError = false;
 
-    if (!configFile->isOpen())
-    {
-        configFile->open(QFile::WriteOnly | QFile::Text);
-        xml->setDevice(configFile);
-    } else
+    QByteArray contents;
+    QBuffer buffer(&contents);
+    buffer.open(QBuffer::WriteOnly | QBuffer::Text);
+    xml->setDevice(&buffer);
+
+    xml->writeStartDocument();
+    joystickXml->writeConfig(xml);
+    xml->writeEndDocument();
+
+    if (xml->hasError())
     {
         writerError = true;
         writerErrorString = tr("Could not write to profile at %1.").arg(configFile->fileName());
     }
 
-    if (!writerError)
-    {
-        xml->writeStartDocument();
-        joystickXml->writeConfig(xml);
-        xml->writeEndDocument();
-    }
+    xml->setDevice(nullptr);
+    buffer.close();
 
-    if (configFile->isOpen())
-        configFile->close();
+    if (!writerError)
+        ProfileSaver::getInstance()->save(configFile->fileName(), contents);
 }
 
 /**
@@ -0,0 +1,171 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2022 Max Maisel <max.maisel@posteo.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "antimicrosettings.h"
+#include "globalvariables.h"
+#include "inputdevice.h"
+#include "inputeventbatch.h"
+#include "joyaxis.h"
+#include "joybuttontypes/joybutton.h"
+#include "joycontrolstick.h"
+#include "setjoystick.h"
+#include "vdpad.h"
+
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QtTest/QtTest>
+
+class FakeInputDevice : public InputDevice
+{
+public:
+    FakeInputDevice(AntiMicroSettings* settings) :
+        InputDevice(nullptr, 0, settings, nullptr)
+    {
+        for (int i = 0; i < GlobalVariables::InputDevice::NUMBER_JOYSETS; i++)
+            getJoystick_sets().insert(i, new SetJoystick(this, i, this));
+    }
+
+    QString getXmlName() const { return "joystick"; }
+    QString getName() { return "Fake device"; }
+    QString getSDLName() { return "Fake device"; }
+    QString getGUIDString() const { return QString(); }
+    QString getUniqueIDString() const { return QString(); }
+    QString getVendorString() const { return QString(); }
+    QString getSerialString() const { return QString(); }
+    QString getProductIDString() const { return QString(); }
+    QString getProductVersion() const { return QString(); }
+    void setCounterUniques(int counter) { Q_UNUSED(counter) }
+    void closeSDLDevice() {}
+    SDL_JoystickID getSDLJoystickID() { return 0; }
+    int getNumberRawButtons() { return 4; }
+    int getNumberRawAxes() { return 2; }
+    int getNumberRawHats() { return 0; }
+    double getRawSensorRate(JoySensorType type) { Q_UNUSED(type) return 0.0; }
+    bool hasRawSensor(JoySensorType type) { Q_UNUSED(type) return false; }
+};
+
+class TestInputEventBatch: public QObject
+{
+    Q_OBJECT
+
+public:
+    TestInputEventBatch(QObject* parent = 0);
+
+private slots:
+    void axisPressAndReleaseInOneBatch();
+    void vdpadPressAndReleaseInOneBatch();
+    void stickPressAndReleaseInOneBatch();
+    void differentElementsShareOneActivation();
+
+private:
+    QTemporaryDir settingsDir;
+    AntiMicroSettings settings;
+    FakeInputDevice device;
+};
+
+TestInputEventBatch::TestInputEventBatch(QObject* parent) :
+    QObject(parent),
+    settingsDir(),
+    settings(settingsDir.filePath("antimicrox_settings.ini"), QSettings::IniFormat),
+    device(&settings)
+{
+}
+
+void TestInputEventBatch::axisPressAndReleaseInOneBatch()
+{
+    device.reset();
+    JoyAxis* axis = device.getActiveSetJoystick()->getJoyAxis(0);
+    QSignalSpy pressed(axis, &JoyAxis::active);
+    QSignalSpy released(axis, &JoyAxis::released);
+
+    InputEventBatch batch;
+    batch.queueAxisEvent(&device, axis, GlobalVariables::JoyAxis::AXISMAX);
+    batch.queueAxisEvent(&device, axis, 0);
+    batch.activate();
+
+    QCOMPARE(pressed.count(), 1);
+    QCOMPARE(released.count(), 1);
+}
+
+void TestInputEventBatch::vdpadPressAndReleaseInOneBatch()
+{
+    device.reset();
+    SetJoystick* set = device.getActiveSetJoystick();
+    VDPad* vdpad = new VDPad(0, set->getIndex(), set, set);
+    vdpad->addVButton(JoyDPadButton::DpadUp, set->getJoyButton(0));
+    vdpad->addVButton(JoyDPadButton::DpadDown, set->getJoyButton(1));
+    vdpad->addVButton(JoyDPadButton::DpadLeft, set->getJoyButton(2));
+    vdpad->addVButton(JoyDPadButton::DpadRight, set->getJoyButton(3));
+    set->addVDPad(0, vdpad);
+
+    QSignalSpy pressed(vdpad, &JoyDPad::active);
+    QSignalSpy released(vdpad, &JoyDPad::released);
+
+    InputEventBatch batch;
+    batch.queueButtonEvent(&device, set->getJoyButton(0), true);
+    batch.queueButtonEvent(&device, set->getJoyButton(0), false);
+    batch.activate();
+
+    QCOMPARE(pressed.count(), 1);
+    QCOMPARE(released.count(), 1);
+}
+
+void TestInputEventBatch::stickPressAndReleaseInOneBatch()
+{
+    device.reset();
+    SetJoystick* set = device.getActiveSetJoystick();
+    JoyAxis* axisX = set->getJoyAxis(0);
+    JoyControlStick* stick = new JoyControlStick(axisX, set->getJoyAxis(1), 0, set->getIndex(), set);
+    set->addControlStick(0, stick);
+
+    QSignalSpy pressed(stick, &JoyControlStick::active);
+    QSignalSpy released(stick, &JoyControlStick::released);
+
+    InputEventBatch batch;
+    batch.queueAxisEvent(&device, axisX, GlobalVariables::JoyAxis::AXISMAX);
+    batch.queueAxisEvent(&device, axisX, 0);
+    batch.activate();
+
+    QCOMPARE(pressed.count(), 1);
+    QCOMPARE(released.count(), 1);
+}
+
+void TestInputEventBatch::differentElementsShareOneActivation()
+{
+    device.reset();
+    SetJoystick* set = device.getActiveSetJoystick();
+    JoyAxis* axisX = set->getJoyAxis(0);
+    JoyAxis* axisY = set->getJoyAxis(1);
+    JoyControlStick* stick = new JoyControlStick(axisX, axisY, 0, set->getIndex(), set);
+    set->addControlStick(0, stick);
+
+    QSignalSpy pressed(stick, &JoyControlStick::active);
+
+    InputEventBatch batch;
+    batch.queueAxisEvent(&device, axisX, GlobalVariables::JoyAxis::AXISMAX);
+    batch.queueAxisEvent(&device, axisY, GlobalVariables::JoyAxis::AXISMAX);
+
+    QVERIFY(stick->hasPendingEvent());
+    batch.activate();
+
+    QCOMPARE(pressed.count(), 1);
+    QCOMPARE(pressed.at(0).at(0).toInt(), GlobalVariables::JoyAxis::AXISMAX);
+    QCOMPARE(pressed.at(0).at(1).toInt(), GlobalVariables::JoyAxis::AXISMAX);
+}
+
+QTEST_MAIN(TestInputEventBatch)
+#include "testinputeventbatch.moc"